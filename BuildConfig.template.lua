@@ -12,7 +12,11 @@ userConfig = {
 		extensions = true,
 		examples = true,
 		unitTests = true,
-		thirdParty = true
+		thirdParty = true,
+
+		-- Enables coroutine-based scripted sequences (SAMPCpp/Core/Coroutine.hpp).
+		-- Requires compiler with C++20 support.
+		coroutines = false
 	},
 	
 	-- Dependencies configuration:
@@ -1,7 +1,7 @@
 project "Engine"
 	kind "StaticLib"
 	language "C++"
-	cppdialect "C++17"
+	cppdialect (edge.cppDialect)
 	location (path.join(repoRoot, "Build/%{prj.name}"))
 	targetdir (path.join(repoRoot, "Bin/%{cfg.platform}/%{cfg.buildcfg}"))
 
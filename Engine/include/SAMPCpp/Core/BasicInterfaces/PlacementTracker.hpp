@@ -40,6 +40,17 @@ struct I3DNodePlacementTracker
 	ActorPlacement getLastPlacement() const {
 		return m_lastPlacement;
 	}
+
+	/// <summary>
+	/// Sets the last placement without notifying about the change.
+	/// </summary>
+	/// <param name="placement_">The placement.</param>
+	/// <remarks>
+	/// <para>Used by bulk updates that handle the change themselves.</para>
+	/// </remarks>
+	void resetPlacement(ActorPlacement const & placement_) {
+		m_lastPlacement = placement_;
+	}
 private:
 	
 	/// <summary>
@@ -85,6 +96,17 @@ struct IGlobalObjectPlacementTracker
 	GlobalObjectPlacement getLastPlacement() const {
 		return m_lastPlacement;
 	}
+
+	/// <summary>
+	/// Sets the last placement without notifying about the change.
+	/// </summary>
+	/// <param name="placement_">The placement.</param>
+	/// <remarks>
+	/// <para>Used by bulk updates that handle the change themselves.</para>
+	/// </remarks>
+	void resetPlacement(GlobalObjectPlacement const & placement_) {
+		m_lastPlacement = placement_;
+	}
 private:
 
 	/// <summary>
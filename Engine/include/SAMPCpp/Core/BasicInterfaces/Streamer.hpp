@@ -14,6 +14,7 @@ class PersonalObject;
 class UniversalObject;
 class Checkpoint;
 class RaceCheckpoint;
+class Scene;
 
 class IStreamer
 {
@@ -48,6 +49,13 @@ public:
 	/// </summary>
 	/// <param name="personalObject_">The personal object.</param>
 	virtual void whenObjectJoinsMap(PersonalObject & personalObject_) = 0;
+
+	/// <summary>
+	/// Event reaction designed to be called when many personal objects of the same player join map at once.
+	/// </summary>
+	/// <param name="owner_">The player that owns every object.</param>
+	/// <param name="personalObjects_">The personal objects.</param>
+	virtual void whenObjectsJoinMap(Player & owner_, std::vector<PersonalObject*> const & personalObjects_) = 0;
 	
 	/// <summary>
 	/// Event reaction designed to be called when universal object joins map.
@@ -168,6 +176,37 @@ public:
 	/// <param name="previousPlacement_">The previous placement.</param>
 	/// <param name="currentPlacement_">The current placement.</param>
 	virtual void whenObjectPlacementChanges(PersonalObject & personalObject_, ActorPlacement const& previousPlacement_, ActorPlacement const& currentPlacement_) = 0;
+
+	/// <summary>
+	/// Event reaction designed to be called after many objects were moved at once (e.g. whole scene).
+	/// </summary>
+	/// <param name="globalObjects_">The moved global objects.</param>
+	/// <param name="universalObjects_">The moved universal objects.</param>
+	virtual void whenObjectsRelocated(std::vector<GlobalObject*> const& globalObjects_, std::vector<UniversalObject*> const& universalObjects_) = 0;
+
+	/// <summary>
+	/// Event reaction designed to be called when the global object starts moving (see <see cref="GlobalObject::moveTo"/>).
+	/// </summary>
+	/// <param name="globalObject_">The global object.</param>
+	virtual void whenObjectStartsMoving(GlobalObject & globalObject_) = 0;
+
+	/// <summary>
+	/// Event reaction designed to be called when the universal object starts moving (see <see cref="UniversalObject::moveTo"/>).
+	/// </summary>
+	/// <param name="universalObject_">The universal object.</param>
+	virtual void whenObjectStartsMoving(UniversalObject & universalObject_) = 0;
+
+	/// <summary>
+	/// Event reaction designed to be called when lazy scene joins map.
+	/// </summary>
+	/// <param name="scene_">The scene.</param>
+	virtual void whenLazySceneJoinsMap(Scene & scene_) = 0;
+
+	/// <summary>
+	/// Event reaction designed to be called when lazy scene leaves map.
+	/// </summary>
+	/// <param name="scene_">The scene.</param>
+	virtual void whenLazySceneLeavesMap(Scene & scene_) = 0;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <atomic>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Bounded multiple-producer, single-consumer queue based on a ring buffer.
+/// </summary>
+/// <remarks>
+/// <para>Producers never block nor allocate: <see cref="tryPush"/> fails when the queue is full.</para>
+/// <para>Only one thread at a time can call <see cref="tryPop"/>.</para>
+/// <para>Every cell carries a sequence number (D. Vyukov's bounded queue algorithm),
+/// so producers synchronize using a single compare-and-swap.</para>
+/// </remarks>
+template <typename T>
+class BoundedMPSCQueue
+{
+public:
+	/// <summary>
+	/// Initializes a new instance of the <see cref="BoundedMPSCQueue"/> class.
+	/// </summary>
+	/// <param name="capacity_">The capacity. Rounded up to the power of two.</param>
+	explicit BoundedMPSCQueue(std::size_t capacity_)
+		:
+		m_cells( roundUpToPowerOfTwo(capacity_) ),
+		m_mask{ m_cells.size() - 1 },
+		m_enqueuePos{ 0 },
+		m_dequeuePos{ 0 }
+	{
+		for (std::size_t i = 0; i < m_cells.size(); ++i)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	BoundedMPSCQueue(BoundedMPSCQueue const&) = delete;
+	BoundedMPSCQueue& operator=(BoundedMPSCQueue const&) = delete;
+
+	/// <summary>
+	/// Tries to push the element. Can be called from any thread.
+	/// </summary>
+	/// <param name="value_">The value.</param>
+	/// <returns>
+	///		<c>true</c> if element was pushed; <c>false</c> if queue is full.
+	/// </returns>
+	bool tryPush(T value_)
+	{
+		Cell* cell;
+		std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			cell = &m_cells[pos & m_mask];
+			std::size_t const seq = cell->sequence.load(std::memory_order_acquire);
+			auto const diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+			if (diff == 0)
+			{
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false; // Full.
+			else
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+		}
+
+		cell->value = std::move(value_);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// Tries to pop the element. Must be called only from the consumer thread.
+	/// </summary>
+	/// <param name="value_">Receives popped value.</param>
+	/// <returns>
+	///		<c>true</c> if element was popped; <c>false</c> if queue is empty.
+	/// </returns>
+	bool tryPop(T & value_)
+	{
+		std::size_t const pos = m_dequeuePos.load(std::memory_order_relaxed);
+		Cell& cell = m_cells[pos & m_mask];
+		std::size_t const seq = cell.sequence.load(std::memory_order_acquire);
+
+		if (seq != pos + 1)
+			return false; // Empty (or the producer did not finish writing yet).
+
+		m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+		value_ = std::move(cell.value);
+		cell.value = T{};
+		cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// Returns approximate number of elements (exact only on the consumer thread without producers).
+	/// </summary>
+	std::size_t getSizeApprox() const
+	{
+		std::size_t const enqueued = m_enqueuePos.load(std::memory_order_relaxed);
+		std::size_t const dequeued = m_dequeuePos.load(std::memory_order_relaxed);
+		return enqueued > dequeued ? enqueued - dequeued : 0;
+	}
+
+	/// <summary>
+	/// Returns the capacity.
+	/// </summary>
+	std::size_t getCapacity() const {
+		return m_cells.size();
+	}
+
+private:
+	/// <summary>
+	/// Returns the smallest power of two not less than specified value.
+	/// </summary>
+	static std::size_t roundUpToPowerOfTwo(std::size_t value_)
+	{
+		std::size_t result = 2;
+		while (result < value_)
+			result *= 2;
+		return result;
+	}
+
+	struct Cell
+	{
+		std::atomic<std::size_t>	sequence;
+		T							value;
+	};
+
+	// Cache line size assumed to be 64 bytes. Keeps producers' and consumer's positions apart.
+	constexpr static std::size_t CacheLineSize = 64;
+
+	std::vector<Cell>									m_cells;
+	std::size_t const									m_mask;
+	alignas(CacheLineSize) std::atomic<std::size_t>		m_enqueuePos;
+	alignas(CacheLineSize) std::atomic<std::size_t>		m_dequeuePos;
+};
+
+}
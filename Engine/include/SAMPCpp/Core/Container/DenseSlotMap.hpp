@@ -0,0 +1,120 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/Pointers.hpp>
+
+#include <unordered_map>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Contiguous container of owning pointers with constant time removal.
+/// </summary>
+/// <remarks>
+/// <para>Elements are identified by their address (which stays stable for the whole element lifetime),
+///	each one remembers its position inside the dense array.</para>
+/// <para>Removal swaps the element with the last one, so iteration order is not preserved.</para>
+/// <para>`TPtr` can also be a raw (non-owning) pointer.</para>
+/// </remarks>
+template <typename T, typename TPtr = SharedPtr<T>>
+class DenseSlotMap
+{
+public:
+	using PointerType		= TPtr;
+	using ContainerType		= std::vector<TPtr>;
+	using const_iterator	= typename ContainerType::const_iterator;
+
+	/// <summary>
+	/// Inserts the element.
+	/// </summary>
+	/// <param name="element_">The element.</param>
+	/// <returns>
+	///		<c>true</c> if element was inserted; <c>false</c> if it is already inside.
+	/// </returns>
+	bool insert(TPtr element_)
+	{
+		const_a inserted = m_positions.emplace(rawOf(element_), m_elements.size()).second;
+		if (inserted)
+			m_elements.push_back(std::move(element_));
+		return inserted;
+	}
+
+	/// <summary>
+	/// Removes the element.
+	/// </summary>
+	/// <param name="element_">The element.</param>
+	/// <returns>Pointer to removed element (empty if element was not found).</returns>
+	TPtr remove(T const & element_)
+	{
+		auto it = m_positions.find(&element_);
+		if (it == m_positions.end())
+			return TPtr{};
+
+		const_a position = it->second;
+		m_positions.erase(it);
+
+		TPtr removed = std::move(m_elements[position]);
+		if (position + 1 != m_elements.size())
+		{
+			m_elements[position] = std::move(m_elements.back());
+			m_positions[ rawOf(m_elements[position]) ] = position;
+		}
+		m_elements.pop_back();
+		return removed;
+	}
+
+	/// <summary>
+	/// Determines whether container holds the element.
+	/// </summary>
+	/// <param name="element_">The element.</param>
+	bool contains(T const & element_) const {
+		return m_positions.find(&element_) != m_positions.end();
+	}
+
+	/// <summary>
+	/// Reserves space for specified number of elements.
+	/// </summary>
+	/// <param name="capacity_">The capacity.</param>
+	void reserve(std::size_t capacity_)
+	{
+		m_elements.reserve(capacity_);
+		m_positions.reserve(capacity_);
+	}
+
+	/// <summary>
+	/// Removes every element.
+	/// </summary>
+	void clear()
+	{
+		m_elements.clear();
+		m_positions.clear();
+	}
+
+	TPtr const& operator[](std::size_t index_) const	{ return m_elements[index_]; }
+	std::size_t size() const							{ return m_elements.size(); }
+	bool empty() const									{ return m_elements.empty(); }
+
+	// Only const iteration, replacing pointers in place would break the positions.
+	const_iterator begin() const	{ return m_elements.begin(); }
+	const_iterator end() const		{ return m_elements.end(); }
+
+private:
+	/// <summary>
+	/// Returns raw pointer to the element.
+	/// </summary>
+	static T const* rawOf(TPtr const & element_)
+	{
+		if constexpr (std::is_pointer_v<TPtr>)
+			return element_;
+		else
+			return element_.get();
+	}
+
+	ContainerType								m_elements;
+	std::unordered_map<T const*, std::size_t>	m_positions;
+};
+
+}
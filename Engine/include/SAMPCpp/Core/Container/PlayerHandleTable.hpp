@@ -0,0 +1,140 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+
+#include <bitset>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Maps player slots to handles (e.g. per-player object handles).
+/// </summary>
+/// <remarks>
+/// <para>Occupied slots are marked in a bitset, handles are stored densely, ordered by slot index.
+///	Position of the handle is the number of occupied slots before it (rank), counted word by word,
+///	so every lookup takes constant time regardless of how many players have the handle.</para>
+/// <para>Takes only a few hundred bytes when empty, so it can be stored inside every streamed object.</para>
+/// </remarks>
+template <typename THandle, std::size_t SlotCount = MAX_PLAYERS>
+class PlayerHandleTable
+{
+public:
+	/// <summary>
+	/// Inserts the handle of specified slot.
+	/// </summary>
+	/// <param name="slot_">The slot (player index).</param>
+	/// <param name="handle_">The handle.</param>
+	/// <returns>
+	///		<c>true</c> if handle was inserted; <c>false</c> if slot is invalid or already has a handle.
+	/// </returns>
+	bool insert(std::size_t slot_, THandle handle_)
+	{
+		if (slot_ >= SlotCount || this->contains(slot_))
+			return false;
+
+		m_handles.insert(m_handles.begin() + this->rankOf(slot_), handle_);
+		m_words[slot_ / WordBits] |= bitOf(slot_);
+		return true;
+	}
+
+	/// <summary>
+	/// Removes the handle of specified slot.
+	/// </summary>
+	/// <param name="slot_">The slot (player index).</param>
+	/// <returns>Removed handle (empty if slot had no handle).</returns>
+	std::optional<THandle> remove(std::size_t slot_)
+	{
+		if (!this->contains(slot_))
+			return std::nullopt;
+
+		const_a it		= m_handles.begin() + this->rankOf(slot_);
+		THandle handle	= *it;
+		m_handles.erase(it);
+		m_words[slot_ / WordBits] &= ~bitOf(slot_);
+		return handle;
+	}
+
+	/// <summary>
+	/// Returns the handle of specified slot.
+	/// </summary>
+	/// <param name="slot_">The slot (player index).</param>
+	/// <returns>The handle (empty if slot has no handle).</returns>
+	std::optional<THandle> find(std::size_t slot_) const
+	{
+		if (!this->contains(slot_))
+			return std::nullopt;
+		return m_handles[this->rankOf(slot_)];
+	}
+
+	/// <summary>
+	/// Determines whether specified slot has a handle.
+	/// </summary>
+	/// <param name="slot_">The slot (player index).</param>
+	bool contains(std::size_t slot_) const {
+		return slot_ < SlotCount && (m_words[slot_ / WordBits] & bitOf(slot_)) != 0;
+	}
+
+	/// <summary>
+	/// Calls the function for every stored handle, in ascending slot order.
+	/// </summary>
+	/// <param name="func_">The function, called with `(std::size_t slot, THandle handle)`.</param>
+	template <typename TFunc>
+	void forEach(TFunc && func_) const
+	{
+		std::size_t rank = 0;
+		for (std::size_t w = 0; w < WordCount; ++w)
+		{
+			Uint64 word = m_words[w];
+			for (std::size_t bit = 0; word != 0; ++bit, word >>= 1)
+			{
+				if (word & 1)
+					func_(w * WordBits + bit, m_handles[rank++]);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Removes every handle.
+	/// </summary>
+	void clear()
+	{
+		m_words.fill(0);
+		m_handles.clear();
+	}
+
+	std::size_t size() const	{ return m_handles.size(); }
+	bool empty() const			{ return m_handles.empty(); }
+
+private:
+	constexpr static std::size_t WordBits	= 64;
+	constexpr static std::size_t WordCount	= (SlotCount + WordBits - 1) / WordBits;
+
+	/// <summary>
+	/// Returns the mask of specified slot inside its word.
+	/// </summary>
+	static Uint64 bitOf(std::size_t slot_) {
+		return Uint64{ 1 } << (slot_ % WordBits);
+	}
+
+	/// <summary>
+	/// Returns number of occupied slots lower than specified one.
+	/// </summary>
+	std::size_t rankOf(std::size_t slot_) const
+	{
+		const_a wordIndex = slot_ / WordBits;
+
+		std::size_t rank = 0;
+		for (std::size_t w = 0; w < wordIndex; ++w)
+			rank += std::bitset<WordBits>(m_words[w]).count();
+		return rank + std::bitset<WordBits>(m_words[wordIndex] & (bitOf(slot_) - 1)).count();
+	}
+
+	std::array<Uint64, WordCount>	m_words = {};
+	std::vector<THandle>			m_handles;
+};
+
+}
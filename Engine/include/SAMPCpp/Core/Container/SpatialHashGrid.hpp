@@ -0,0 +1,417 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+
+#include <unordered_map>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Cell arithmetic shared by grids of square cells (on the XY plane).
+/// </summary>
+/// <remarks>
+/// <para>Coordinates are clamped to <see cref="MaxCoord"/> (NaN is clamped too), so cell coordinates never overflow.</para>
+/// </remarks>
+struct GridCells
+{
+	using Coords = std::pair<Int64, Int64>;
+
+	/// Coordinates are clamped to this distance from the origin.
+	constexpr static float MaxCoord = 1'000'000.f;
+
+	/// <summary>
+	/// Clamps the coordinate, so that cell coordinates cannot overflow.
+	/// </summary>
+	static float clampCoord(float value_)
+	{
+		if (!(value_ >= -MaxCoord))		// Also handles NaN.
+			return -MaxCoord;
+		return std::min(value_, MaxCoord);
+	}
+
+	/// <summary>
+	/// Returns coordinates of the cell that contains specified point.
+	/// </summary>
+	static Coords cellOf(float x_, float y_, float cellSize_)
+	{
+		return {
+				static_cast<Int64>(std::floor(clampCoord(x_) / cellSize_)),
+				static_cast<Int64>(std::floor(clampCoord(y_) / cellSize_))
+			};
+	}
+
+	/// <summary>
+	/// Returns number of cells in the rectangle between (inclusive) specified cells.
+	/// </summary>
+	static double countCells(Coords const & min_, Coords const & max_)
+	{
+		if (min_.first > max_.first || min_.second > max_.second)
+			return 0;
+
+		return	static_cast<double>(max_.first - min_.first + 1) *
+				static_cast<double>(max_.second - min_.second + 1);
+	}
+
+	/// <summary>
+	/// Packs cell coordinates into single key.
+	/// </summary>
+	static Uint64 packKey(Int64 x_, Int64 y_)
+	{
+		return (static_cast<Uint64>(static_cast<Uint32>(x_)) << 32) | static_cast<Uint32>(y_);
+	}
+
+	/// <summary>
+	/// Unpacks cell coordinates from the key.
+	/// </summary>
+	static Coords unpackKey(Uint64 key_)
+	{
+		return {
+				static_cast<Int32>(static_cast<Uint32>(key_ >> 32)),
+				static_cast<Int32>(static_cast<Uint32>(key_))
+			};
+	}
+};
+
+/// <summary>
+/// Uniform grid of square cells (on the XY plane), stored sparsely in a hash map.
+/// </summary>
+/// <remarks>
+/// <para>Every element is stored along with its location. Queries check exact (3D) distance.</para>
+/// <para>Clearing the grid keeps cell buffers, so rebuilding it every tick does not allocate after warm-up.</para>
+/// <para>Queries never probe more cell coordinates than there are allocated cells. Larger areas iterate allocated cells instead,
+///	so a query with a huge radius costs no more than a linear scan.</para>
+/// </remarks>
+template <typename T>
+class SpatialHashGrid
+{
+public:
+	/// Queries are clamped to this radius (and to this distance from the origin).
+	constexpr static float MaxQueryRadius = GridCells::MaxCoord;
+
+	/// <summary>
+	/// Single element stored in the grid.
+	/// </summary>
+	struct Entry
+	{
+		math::Vector3f	location;
+		T				value;
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SpatialHashGrid"/> class.
+	/// </summary>
+	/// <param name="cellSize_">Size of a single (square) cell.</param>
+	explicit SpatialHashGrid(float cellSize_)
+		: m_cellSize{ cellSize_ }, m_size{ 0 }
+	{
+		assert(cellSize_ > 0.f);
+	}
+
+	/// <summary>
+	/// Inserts the element.
+	/// </summary>
+	/// <param name="location_">Location of the element.</param>
+	/// <param name="value_">The element.</param>
+	void insert(math::Vector3f const & location_, T value_)
+	{
+		m_cells[ this->keyOf(location_) ].push_back( Entry{ location_, std::move(value_) } );
+		++m_size;
+	}
+
+	/// <summary>
+	/// Removes the element.
+	/// </summary>
+	/// <param name="location_">Location the element was inserted (or last moved) with.</param>
+	/// <param name="value_">The element.</param>
+	/// <returns>
+	///		<c>true</c> if element was found and removed; otherwise, <c>false</c>.
+	/// </returns>
+	bool remove(math::Vector3f const & location_, T const & value_)
+	{
+		auto cellIt = m_cells.find( this->keyOf(location_) );
+		if (cellIt == m_cells.end())
+			return false;
+
+		auto& entries = cellIt->second;
+		auto it = std::find_if(entries.begin(), entries.end(),
+				[&value_](Entry const& entry_) { return entry_.value == value_; }
+			);
+		if (it == entries.end())
+			return false;
+
+		// Swap-remove, order inside cell does not matter.
+		*it = std::move(entries.back());
+		entries.pop_back();
+		--m_size;
+		return true;
+	}
+
+	/// <summary>
+	/// Moves the element to a new location.
+	/// </summary>
+	/// <param name="previousLocation_">Previous location of the element.</param>
+	/// <param name="newLocation_">New location of the element.</param>
+	/// <param name="value_">The element.</param>
+	void move(math::Vector3f const & previousLocation_, math::Vector3f const & newLocation_, T const & value_)
+	{
+		if (this->keyOf(previousLocation_) == this->keyOf(newLocation_))
+		{
+			auto& entries = m_cells[ this->keyOf(newLocation_) ];
+			for (auto & entry : entries)
+			{
+				if (entry.value == value_)
+				{
+					entry.location = newLocation_;
+					return;
+				}
+			}
+		}
+
+		this->remove(previousLocation_, value_);
+		this->insert(newLocation_, value_);
+	}
+
+	/// <summary>
+	/// Removes every element. Keeps allocated cell buffers.
+	/// </summary>
+	void clear()
+	{
+		for (auto & [key, entries] : m_cells)
+			entries.clear();
+		m_size = 0;
+	}
+
+	/// <summary>
+	/// Calls the function for every element inside cells overlapping with specified rectangle.
+	/// </summary>
+	/// <param name="min_">Minimal corner of the rectangle.</param>
+	/// <param name="max_">Maximal corner of the rectangle.</param>
+	/// <param name="func_">The function, called with `Entry const&`.</param>
+	/// <remarks>
+	/// <para>Elements are not filtered, some of them might lie outside of the rectangle.</para>
+	/// </remarks>
+	template <typename TFunc>
+	void forEachInArea(math::Vector2f const & min_, math::Vector2f const & max_, TFunc && func_) const
+	{
+		const_a minCell = this->cellOf(min_.x, min_.y);
+		const_a maxCell = this->cellOf(max_.x, max_.y);
+		const_a cellCount = GridCells::countCells(minCell, maxCell);
+		if (cellCount == 0)
+			return;
+
+		// Area covers more cells than there are allocated, iterate allocated ones.
+		if (cellCount > static_cast<double>(m_cells.size()))
+		{
+			for (auto const & [key, entries] : m_cells)
+			{
+				const_a cell = GridCells::unpackKey(key);
+				if (cell.first < minCell.first || cell.first > maxCell.first ||
+					cell.second < minCell.second || cell.second > maxCell.second)
+					continue;
+
+				for (auto const & entry : entries)
+					func_(entry);
+			}
+			return;
+		}
+
+		for (Int64 x = minCell.first; x <= maxCell.first; ++x)
+		{
+			for (Int64 y = minCell.second; y <= maxCell.second; ++y)
+			{
+				auto cellIt = m_cells.find( GridCells::packKey(x, y) );
+				if (cellIt == m_cells.end())
+					continue;
+
+				for (auto const & entry : cellIt->second)
+					func_(entry);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Calls the function for every element within the radius from specified location.
+	/// </summary>
+	/// <param name="center_">The center.</param>
+	/// <param name="radius_">The radius.</param>
+	/// <param name="func_">The function, called with `Entry const&`.</param>
+	template <typename TFunc>
+	void forEachInRadius(math::Vector3f const & center_, float radius_, TFunc && func_) const
+	{
+		radius_ = clampRadius(radius_);
+
+		const_a radiusSq = radius_ * radius_;
+		this->forEachInArea(
+				math::Vector2f{ center_.x - radius_, center_.y - radius_ },
+				math::Vector2f{ center_.x + radius_, center_.y + radius_ },
+				[&](Entry const & entry_)
+				{
+					if (entry_.location.distanceSquared(center_) <= radiusSq)
+						func_(entry_);
+				}
+			);
+	}
+
+	/// <summary>
+	/// Finds up to `count_` elements nearest to specified location.
+	/// </summary>
+	/// <param name="center_">The center.</param>
+	/// <param name="count_">Maximal number of elements.</param>
+	/// <param name="maxRadius_">Maximal distance from the center.</param>
+	/// <param name="filter_">Predicate called with `Entry const&`, skips elements it returns false for.</param>
+	/// <returns>Entries sorted by distance (ascending).</returns>
+	/// <remarks>
+	/// <para>Searches rings of cells around the center and stops as soon as the result cannot change.
+	///	Falls back to scanning allocated cells once rings would probe more cells than there are allocated.</para>
+	/// </remarks>
+	template <typename TFilter>
+	std::vector<Entry const*> findNearest(math::Vector3f const & center_, std::size_t count_, float maxRadius_, TFilter && filter_) const
+	{
+		using Candidate = std::pair<float, Entry const*>;
+
+		std::vector<Candidate> candidates;
+		if (count_ == 0 || m_size == 0)
+			return {};
+
+		maxRadius_ = clampRadius(maxRadius_);
+
+		const_a maxRadiusSq		= maxRadius_ * maxRadius_;
+		const_a centerCell		= this->cellOf(center_.x, center_.y);
+		const_a maxRing			= static_cast<Int64>(std::ceil(maxRadius_ / m_cellSize));
+
+		auto const visitEntries = [&](std::vector<Entry> const & entries_)
+			{
+				for (auto const & entry : entries_)
+				{
+					const_a distSq = entry.location.distanceSquared(center_);
+					if (distSq <= maxRadiusSq && filter_(entry))
+						candidates.emplace_back(distSq, &entry);
+				}
+			};
+
+		auto const visitCell = [&](Int64 x_, Int64 y_)
+			{
+				auto cellIt = m_cells.find( GridCells::packKey(x_, y_) );
+				if (cellIt != m_cells.end())
+					visitEntries(cellIt->second);
+			};
+
+		std::size_t probedCells = 0;
+		for (Int64 ring = 0; ring <= maxRing; ++ring)
+		{
+			// Next ring would probe more cells than a full scan, scan every allocated cell instead.
+			probedCells += (ring == 0) ? 1 : static_cast<std::size_t>(8 * ring);
+			if (probedCells > m_cells.size())
+			{
+				candidates.clear();
+				for (auto const & [key, entries] : m_cells)
+					visitEntries(entries);
+				break;
+			}
+
+			if (ring == 0)
+				visitCell(centerCell.first, centerCell.second);
+			else
+			{
+				for (Int64 i = -ring; i <= ring; ++i)
+				{
+					visitCell(centerCell.first + i, centerCell.second - ring);
+					visitCell(centerCell.first + i, centerCell.second + ring);
+				}
+				for (Int64 i = -ring + 1; i <= ring - 1; ++i)
+				{
+					visitCell(centerCell.first - ring, centerCell.second + i);
+					visitCell(centerCell.first + ring, centerCell.second + i);
+				}
+			}
+
+			// Every element closer than `ring * cellSize` (on the XY plane) was already visited.
+			if (candidates.size() >= count_)
+			{
+				std::nth_element(candidates.begin(), candidates.begin() + (count_ - 1), candidates.end(),
+						[](Candidate const& l_, Candidate const& r_) { return l_.first < r_.first; }
+					);
+				const_a coveredRadius = static_cast<float>(ring) * m_cellSize;
+				if (candidates[count_ - 1].first <= coveredRadius * coveredRadius)
+					break;
+			}
+		}
+
+		std::sort(candidates.begin(), candidates.end(),
+				[](Candidate const& l_, Candidate const& r_) { return l_.first < r_.first; }
+			);
+		if (candidates.size() > count_)
+			candidates.resize(count_);
+
+		std::vector<Entry const*> result;
+		result.reserve(candidates.size());
+		for (auto const & candidate : candidates)
+			result.push_back(candidate.second);
+		return result;
+	}
+
+	/// <summary>
+	/// Finds up to `count_` elements nearest to specified location.
+	/// </summary>
+	/// <param name="center_">The center.</param>
+	/// <param name="count_">Maximal number of elements.</param>
+	/// <param name="maxRadius_">Maximal distance from the center.</param>
+	/// <returns>Entries sorted by distance (ascending).</returns>
+	std::vector<Entry const*> findNearest(math::Vector3f const & center_, std::size_t count_, float maxRadius_) const
+	{
+		return this->findNearest(center_, count_, maxRadius_, [](Entry const&) { return true; });
+	}
+
+	/// <summary>
+	/// Returns number of stored elements.
+	/// </summary>
+	std::size_t size() const {
+		return m_size;
+	}
+
+	/// <summary>
+	/// Returns size of a single cell.
+	/// </summary>
+	float getCellSize() const {
+		return m_cellSize;
+	}
+
+private:
+	using CellCoords = GridCells::Coords;
+
+	/// <summary>
+	/// Returns coordinates of the cell that contains specified point.
+	/// </summary>
+	CellCoords cellOf(float x_, float y_) const {
+		return GridCells::cellOf(x_, y_, m_cellSize);
+	}
+
+	/// <summary>
+	/// Clamps the query radius.
+	/// </summary>
+	static float clampRadius(float radius_)
+	{
+		if (!(radius_ >= 0.f))				// Also handles NaN.
+			return 0.f;
+		return std::min(radius_, MaxQueryRadius);
+	}
+
+	/// <summary>
+	/// Returns key of the cell that contains specified point.
+	/// </summary>
+	Uint64 keyOf(math::Vector3f const & location_) const
+	{
+		const_a cell = this->cellOf(location_.x, location_.y);
+		return GridCells::packKey(cell.first, cell.second);
+	}
+
+	float											m_cellSize;
+	std::size_t										m_size;
+	std::unordered_map< Uint64, std::vector<Entry> >	m_cells;
+};
+
+}
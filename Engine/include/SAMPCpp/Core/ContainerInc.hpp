@@ -4,4 +4,8 @@
 
 
 #include "Container/DivisibleGrid2.hpp"
-#include "Container/DivisibleGrid3.hpp"
\ No newline at end of file
+#include "Container/DivisibleGrid3.hpp"
+#include "Container/BoundedMPSCQueue.hpp"
+#include "Container/SpatialHashGrid.hpp"
+#include "Container/DenseSlotMap.hpp"
+#include "Container/PlayerHandleTable.hpp"
\ No newline at end of file
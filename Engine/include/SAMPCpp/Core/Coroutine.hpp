@@ -0,0 +1,231 @@
+// File description:
+// Implements coroutine-based scripted sequences resumed by the TaskScheduler.
+// Available only when built with coroutine support (C++20, SAMP_EDGENGINE_COROUTINES).
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#ifdef SAMP_EDGENGINE_COROUTINES
+
+#include <SAMPCpp/Core/TaskSystem.hpp>
+
+#include <coroutine>
+
+
+namespace samp_cpp
+{
+
+/// <summary>
+///		Recycles coroutine frames grouped in size classes.
+/// </summary>
+/// <remarks>
+/// <para>Released frames are kept on intrusive free lists, so starting a sequence after warm-up does not hit the global allocator.</para>
+/// <para>Frames bigger than <see cref="MaxPooledSize"/> bytes bypass the pool.</para>
+/// <para>Not thread safe - coroutines are meant to be started and resumed on the main thread.</para>
+/// </remarks>
+class CoroutineFramePool
+{
+public:
+	constexpr static std::size_t Granularity	= 64;
+	constexpr static std::size_t MaxPooledSize	= 2048;
+	constexpr static std::size_t ClassCount		= MaxPooledSize / Granularity;
+
+	/// <summary>
+	///		Finalizes an instance of the <see cref="CoroutineFramePool"/> class. Frees every cached frame.
+	/// </summary>
+	~CoroutineFramePool();
+
+	/// <summary>
+	///		Returns the pool used by every <see cref="Coroutine"/>.
+	/// </summary>
+	static CoroutineFramePool& instance();
+
+	/// <summary>
+	///		Allocates frame of specified size.
+	/// </summary>
+	/// <param name="size_">Size of the frame in bytes.</param>
+	void* allocate(std::size_t size_);
+
+	/// <summary>
+	///		Returns frame to the pool.
+	/// </summary>
+	/// <param name="frame_">The frame.</param>
+	/// <param name="size_">Size of the frame in bytes (same as passed to allocate).</param>
+	void deallocate(void* frame_, std::size_t size_) noexcept;
+
+private:
+	struct FreeFrame
+	{
+		FreeFrame* next;
+	};
+
+	/// <summary>
+	///		Returns index of the size class for frame of specified size.
+	/// </summary>
+	static std::size_t sizeClassOf(std::size_t size_) {
+		return (size_ + Granularity - 1) / Granularity - 1;
+	}
+
+	std::array<FreeFrame*, ClassCount> m_freeFrames = {};
+};
+
+/// <summary>
+///		Return type of scripted sequence coroutines.
+/// </summary>
+/// <remarks>
+/// <para>The coroutine is created suspended. Pass it to <see cref="TaskScheduler::start"/> to run it.</para>
+/// <para>Scheduler destroys the frame once the sequence ends or gets cancelled. Sequences that never started are destroyed with the <see cref="Coroutine"/> object.</para>
+/// <para>Sequences that refer to objects that may die in the meantime (f.e. players) should be bound to them,
+///	so that they are cancelled instead of resumed with dangling references.</para>
+/// <para>Exception thrown out of the sequence ends it and is reported by <see cref="TaskScheduler::onCoroutineException"/>.</para>
+/// </remarks>
+/// <example>
+/// <code>
+/// Coroutine countdown(Player& player_)
+/// {
+///		for(int i = 3; i > 0; --i)
+///		{
+///			player_.sendMessage(text::format("{0}...", i));
+///			co_await sleepFor(1s);
+///		}
+///		player_.unfreeze();
+/// }
+///
+/// GameMode->tasks.start(player, countdown(player));
+/// </code>
+/// </example>
+class Coroutine
+{
+public:
+	struct promise_type
+	{
+		TaskScheduler*		scheduler = nullptr;
+		TaskHandle			handle;			// Slot of the scheduler the coroutine occupies.
+		std::exception_ptr	exception;		// Exception the coroutine ended with.
+
+		Coroutine get_return_object() {
+			return Coroutine{ std::coroutine_handle<promise_type>::from_promise(*this) };
+		}
+
+		// Stays suspended at the end, so that the scheduler can read the exception and destroy the frame.
+		std::suspend_always initial_suspend() noexcept	{ return {}; }
+		std::suspend_always final_suspend() noexcept	{ return {}; }
+		void return_void() noexcept						{}
+		void unhandled_exception() noexcept				{ exception = std::current_exception(); }
+
+		static void* operator new(std::size_t size_) {
+			return CoroutineFramePool::instance().allocate(size_);
+		}
+		static void operator delete(void* frame_, std::size_t size_) noexcept {
+			CoroutineFramePool::instance().deallocate(frame_, size_);
+		}
+	};
+
+	using HandleType = std::coroutine_handle<promise_type>;
+
+	/// <summary>
+	///		Initializes a new instance of the <see cref="Coroutine"/> class.
+	/// </summary>
+	/// <param name="handle_">Handle to the coroutine.</param>
+	explicit Coroutine(HandleType handle_)
+		: m_handle{ handle_ }
+	{
+	}
+
+	Coroutine(Coroutine const&) = delete;
+	Coroutine& operator=(Coroutine const&) = delete;
+
+	Coroutine(Coroutine && rhs_) noexcept
+		: m_handle{ std::exchange(rhs_.m_handle, nullptr) }
+	{
+	}
+
+	Coroutine& operator=(Coroutine && rhs_) noexcept
+	{
+		if (this != &rhs_)
+		{
+			if (m_handle)
+				m_handle.destroy();
+			m_handle = std::exchange(rhs_.m_handle, nullptr);
+		}
+		return *this;
+	}
+
+	/// <summary>
+	///		Finalizes an instance of the <see cref="Coroutine"/> class. Destroys the frame if it never started.
+	/// </summary>
+	~Coroutine()
+	{
+		if (m_handle)
+			m_handle.destroy();
+	}
+
+	/// <summary>
+	///		Gives up the ownership of the coroutine frame.
+	/// </summary>
+	HandleType release() {
+		return std::exchange(m_handle, nullptr);
+	}
+
+private:
+	HandleType m_handle;
+};
+
+/// <summary>
+///		Awaitable that resumes the coroutine after specified time.
+/// </summary>
+struct SleepAwaitable
+{
+	IUpdatable::Duration duration;
+
+	bool await_ready() const noexcept {
+		return duration <= IUpdatable::Duration::zero();
+	}
+
+	void await_suspend(Coroutine::HandleType handle_) const {
+		auto& promise = handle_.promise();
+		promise.scheduler->resumeAt(IUpdatable::Clock::now() + duration, promise.handle);
+	}
+
+	void await_resume() const noexcept {}
+};
+
+/// <summary>
+///		Awaitable that resumes the coroutine during next scheduler update.
+/// </summary>
+struct NextTickAwaitable
+{
+	bool await_ready() const noexcept {
+		return false;
+	}
+
+	void await_suspend(Coroutine::HandleType handle_) const {
+		auto& promise = handle_.promise();
+		promise.scheduler->resumeNextTick(promise.handle);
+	}
+
+	void await_resume() const noexcept {}
+};
+
+/// <summary>
+///		Suspends the coroutine for specified time.
+/// </summary>
+/// <param name="duration_">The duration.</param>
+template <typename Rep, typename Period>
+SleepAwaitable sleepFor(chrono::duration<Rep, Period> const & duration_)
+{
+	return SleepAwaitable{ chrono::duration_cast<IUpdatable::Duration>(duration_) };
+}
+
+/// <summary>
+///		Suspends the coroutine until next scheduler update.
+/// </summary>
+inline NextTickAwaitable nextTick()
+{
+	return NextTickAwaitable{};
+}
+
+}
+
+#endif
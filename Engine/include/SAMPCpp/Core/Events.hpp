@@ -424,4 +424,115 @@ private:
 	std::vector< UniquePtr< EventHook<_Args...> > > m_hooks;
 };
 
+/// <summary>
+/// Event dispatcher that queues events and delivers them later, once per key.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Posting an event with a key that is already pending replaces its arguments,
+///		so handlers receive only the latest state. Events are delivered by <see cref="flush"/>
+///		in order in which their keys were first posted.
+/// </para>
+/// <para>Useful for high-frequency events (e.g. player update) whose handlers only need the latest state.</para>
+/// <para>Keys should be small integers (e.g. player index), because pending slots are indexed by key.</para>
+/// </remarks>
+template <typename... _Args>
+class DeferredEventDispatcher
+	: public EventDispatcher<_Args...>
+{
+public:
+	using KeyType = std::size_t;
+
+	/// <summary>
+	/// Queues the event with specified key and arguments.
+	/// </summary>
+	/// <param name="key_">The coalescing key.</param>
+	/// <param name="args_">The arguments.</param>
+	void post(KeyType key_, _Args const&... args_)
+	{
+		if (key_ >= m_slots.size())
+			m_slots.resize(key_ + 1);
+
+		auto& slot = m_slots[key_];
+		if (!slot)
+			m_pendingKeys.push_back(key_);
+
+		slot.emplace(args_...);
+	}
+
+	/// <summary>
+	/// Drops pending event with specified key.
+	/// </summary>
+	/// <param name="key_">The coalescing key.</param>
+	/// <remarks>
+	/// <para>Use it when objects passed as arguments are about to be destroyed (e.g. player disconnects).</para>
+	/// </remarks>
+	void discard(KeyType key_)
+	{
+		if (key_ < m_slots.size() && m_slots[key_])
+		{
+			m_slots[key_].reset();
+
+			auto it = std::find(m_pendingKeys.begin(), m_pendingKeys.end(), key_);
+			if (it != m_pendingKeys.end())
+				m_pendingKeys.erase(it);
+		}
+
+		// Event might be taken by the flush that is running right now and not delivered yet.
+		auto it = std::find(m_flushedKeys.begin(), m_flushedKeys.end(), key_);
+		if (it != m_flushedKeys.end())
+			m_flushedArgs[ static_cast<std::size_t>(it - m_flushedKeys.begin()) ].reset();
+	}
+
+	/// <summary>
+	/// Delivers every pending event.
+	/// </summary>
+	/// <remarks>
+	/// <para>Pending events are taken out before first handler is called, so events posted by handlers
+	///	during the flush (even with keys that were not delivered yet) are delivered by the next flush.</para>
+	/// <para>Events discarded by handlers during the flush are not delivered.</para>
+	/// </remarks>
+	void flush()
+	{
+		m_flushedKeys.clear();
+		m_flushedKeys.swap(m_pendingKeys);
+
+		m_flushedArgs.clear();
+		for (auto key : m_flushedKeys)
+		{
+			m_flushedArgs.push_back(std::move(m_slots[key]));
+			m_slots[key].reset();
+		}
+
+		for (std::size_t i = 0; i < m_flushedArgs.size(); ++i)
+		{
+			// Event could be discarded by one of the handlers.
+			auto& flushed = m_flushedArgs[i];
+			if (!flushed)
+				continue;
+
+			auto args = std::move(*flushed);
+			flushed.reset();
+
+			std::apply(
+					[this](_Args const&... args_) { this->emit(args_...); },
+					args
+				);
+		}
+	}
+
+	/// <summary>
+	/// Returns number of pending events.
+	/// </summary>
+	std::size_t getPendingCount() const {
+		return m_pendingKeys.size();
+	}
+
+private:
+	std::vector< std::optional< std::tuple<_Args...> > >	m_slots;		// Latest arguments, indexed by key.
+	std::vector<KeyType>									m_pendingKeys;	// Keys in order of first posting.
+	std::vector<KeyType>									m_flushedKeys;	// Keys taken by the last flush.
+	std::vector< std::optional< std::tuple<_Args...> > >	m_flushedArgs;	// Arguments taken by the last flush, parallel to m_flushedKeys.
+};
+
 }
@@ -0,0 +1,118 @@
+// File description:
+// Implements queue that allows other threads to post work into the game thread.
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+#include <SAMPCpp/Core/Container/BoundedMPSCQueue.hpp>
+#include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
+
+#include <atomic>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Bounded queue of functions posted from any thread and executed on the game thread.
+/// </summary>
+/// <remarks>
+/// <para>Posting never blocks. When the queue is full, <see cref="post"/> fails and the rejection is counted (back-pressure).</para>
+/// <para>The server drains the queue once per frame (FramePhase::Input), within the drain budget.</para>
+/// <code>
+///		// On a worker thread:
+///		if (!Server->mainThread.post([=]{ player->sendMessage(result); }))
+///			retryLater();
+/// </code>
+/// </remarks>
+class MainThreadQueue
+{
+public:
+	// Aliases:
+	using FuncType = std::function<void()>;
+
+	constexpr static std::size_t DefaultCapacity	= 4096;
+	constexpr static std::size_t DefaultDrainBudget	= 256;
+
+	/// <summary>
+	/// Queue statistics.
+	/// </summary>
+	struct Stats
+	{
+		std::uint64_t	posted			= 0;	// Functions accepted.
+		std::uint64_t	rejected		= 0;	// Functions rejected because the queue was full.
+		std::uint64_t	executed		= 0;	// Functions executed on the game thread.
+		std::size_t		lastBacklog		= 0;	// Functions left in the queue after the last drain.
+		std::size_t		peakBacklog		= 0;	// Highest backlog observed when draining.
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="MainThreadQueue"/> class.
+	/// </summary>
+	/// <param name="capacity_">The capacity (rounded up to the power of two).</param>
+	explicit MainThreadQueue(std::size_t capacity_ = DefaultCapacity);
+
+	/// <summary>
+	/// Posts the function to be executed on the game thread. Can be called from any thread.
+	/// </summary>
+	/// <param name="func_">The function.</param>
+	/// <returns>
+	///		<c>true</c> if function was queued; <c>false</c> if queue is full.
+	/// </returns>
+	bool post(FuncType func_);
+
+	/// <summary>
+	/// Executes queued functions. Must be called on the game thread.
+	/// </summary>
+	/// <returns>Number of executed functions.</returns>
+	/// <remarks>
+	/// <para>Stops after executing <see cref="setDrainBudget">drain budget</see> functions or when time budget runs out.</para>
+	/// </remarks>
+	std::size_t drain();
+
+	/// <summary>
+	/// Sets maximal number of functions executed by single drain.
+	/// </summary>
+	/// <param name="maxCount_">Maximal number of functions.</param>
+	void setDrainBudget(std::size_t maxCount_) {
+		m_drainBudget = maxCount_;
+	}
+
+	/// <summary>
+	/// Sets maximal time spent by single drain. Zero means no time limit.
+	/// </summary>
+	/// <param name="maxTime_">Maximal time.</param>
+	template <typename Rep, typename Period>
+	void setDrainTimeBudget(chrono::duration<Rep, Period> const & maxTime_) {
+		m_drainTimeBudget = chrono::duration_cast<IUpdatable::Duration>(maxTime_);
+	}
+
+	/// <summary>
+	/// Returns queue statistics.
+	/// </summary>
+	Stats getStats() const;
+
+	/// <summary>
+	/// Returns the capacity.
+	/// </summary>
+	std::size_t getCapacity() const {
+		return m_queue.getCapacity();
+	}
+
+private:
+	BoundedMPSCQueue<FuncType>		m_queue;
+	std::size_t						m_drainBudget;
+	IUpdatable::Duration			m_drainTimeBudget;
+
+	// Producer-side stats (written by any thread):
+	std::atomic<std::uint64_t>		m_posted;
+	std::atomic<std::uint64_t>		m_rejected;
+
+	// Consumer-side stats (written only by the game thread):
+	std::uint64_t					m_executed;
+	std::size_t						m_lastBacklog;
+	std::size_t						m_peakBacklog;
+};
+
+}
@@ -6,13 +6,64 @@
 #include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
 #include <SAMPCpp/Core/Pointers.hpp>
 
+#ifdef SAMP_EDGENGINE_COROUTINES
+	#include <SAMPCpp/Core/Events.hpp>
+
+	#include <coroutine>
+	#include <exception>
+#endif
+
 
 namespace samp_cpp
 {
 
+class TaskScheduler;
+#ifdef SAMP_EDGENGINE_COROUTINES
+class Coroutine;
+#endif
+
+/// <summary>
+///		Generation-checked reference to a task stored inside <see cref="TaskScheduler"/>'s pool.
+/// </summary>
+/// <remarks>
+/// <para>Handles are plain values: copying them involves no allocation nor reference counting.</para>
+/// <para>Once a task ends (or gets cancelled) its slot is reused and every handle pointing to it becomes stale.</para>
+/// </remarks>
+struct TaskHandle
+{
+	static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+	std::uint32_t index			= InvalidIndex;
+	std::uint32_t generation	= 0;
+
+	/// <summary>
+	///		Determines whether the handle was ever assigned to a task.
+	/// </summary>
+	bool isNull() const {
+		return index == InvalidIndex;
+	}
+
+	/// <summary>
+	///		Resets the handle to null state. Does not cancel the task.
+	/// </summary>
+	void reset() {
+		*this = TaskHandle{};
+	}
+
+	bool operator==(TaskHandle const & other_) const {
+		return index == other_.index && generation == other_.generation;
+	}
+	bool operator!=(TaskHandle const & other_) const {
+		return !(*this == other_);
+	}
+};
+
 /// <summary>
 ///		Encapsulates single task (postponed function call).
 /// </summary>
+/// <remarks>
+/// <para>Tasks are pool-allocated by <see cref="TaskScheduler"/> and referenced through <see cref="TaskHandle"/>.</para>
+/// </remarks>
 class Task
 {
 public:
@@ -71,12 +122,23 @@ public:
 
 	friend class TaskScheduler;
 private:
+	/// <summary>
+	///		Initializes a new, empty pool slot.
+	/// </summary>
+	Task();
 
 	bool 					m_running;
 	IUpdatable::Duration 	m_interval;
 	IUpdatable::TimePoint 	m_lastExecution;
 	std::uintmax_t 			m_repeatCount;
 	FuncType 				m_function;
+#ifdef SAMP_EDGENGINE_COROUTINES
+	std::coroutine_handle<>	m_coroutine;	// Set if the slot holds a coroutine instead of a function.
+#endif
+
+	// Pool bookkeeping (intrusive):
+	std::uint32_t			m_generation;	// Incremented every time the slot is released.
+	std::uint32_t			m_nextFree;		// Next free slot index (valid only when the slot is free).
 };
 
 /// <summary>
@@ -85,15 +147,29 @@ private:
 class ITaskOwner
 {
 public:
-	using ContainerType = std::vector< SharedPtr<Task> >;
+	struct OwnedTask
+	{
+		TaskScheduler*	scheduler;
+		TaskHandle		handle;
+	};
+
+	using ContainerType = std::vector< OwnedTask >;
+
+	/// <summary>
+	///		Finalizes an instance of the <see cref="ITaskOwner"/> class. Cancels every owned task.
+	/// </summary>
+	~ITaskOwner();
 
 	/// <summary>
 	///		Inserts new task.
 	/// </summary>
-	void interceptTask(SharedPtr<Task> task_, bool cleanup_ = true);
+	/// <param name="scheduler_">The scheduler the task was scheduled with.</param>
+	/// <param name="task_">Handle to the task.</param>
+	/// <param name="cleanup_">Whether to remove ended tasks first.</param>
+	void interceptTask(TaskScheduler & scheduler_, TaskHandle task_, bool cleanup_ = true);
 
 	/// <summary>
-	///		Removes every running task.
+	///		Cancels and removes every running task.
 	/// </summary>
 	void removeAllTasks();
 
@@ -109,6 +185,10 @@ private:
 /// <summary>
 /// Processes scheduled tasks.
 /// </summary>
+/// <remarks>
+/// <para>Tasks live in a pool of reusable slots, so scheduling and cancelling does not allocate (once the pool is warm).</para>
+/// <para>A task runs until its repeat count reaches zero or it is cancelled. Nobody has to keep it alive.</para>
+/// </remarks>
 class TaskScheduler
 	: public IUpdatable
 {
@@ -119,24 +199,104 @@ public:
 	/// Initializes a new instance of the <see cref="TaskScheduler"/> class.
 	/// </summary>
 	TaskScheduler()
-		: m_performsTaskExecution{false}
+		:
+		m_firstFree{ TaskHandle::InvalidIndex },
+		m_executedSlot{ TaskHandle::InvalidIndex },
+		m_performsTaskExecution{ false }
 	{
 	}
 
+#ifdef SAMP_EDGENGINE_COROUTINES
+	/// <summary>
+	/// Finalizes an instance of the <see cref="TaskScheduler"/> class. Destroys every suspended coroutine.
+	/// </summary>
+	~TaskScheduler();
+#endif
+
 	/// <summary>
 	/// Schedules task with the specified parameters.
 	/// </summary>
 	/// <param name="interval_">The interval.</param>
 	/// <param name="func_">The function to be executed.</param>
 	/// <param name="repeatCount_">The repeat count.</param>
-	/// <returns>Shared pointer to the scheduled task.</returns>
+	/// <returns>Handle to the scheduled task.</returns>
 	template <typename Rep, typename Period>	
-	SharedPtr<Task> schedule(chrono::duration<Rep, Period> const & interval_, Task::FuncType func_, std::uintmax_t repeatCount_ = 1)
+	TaskHandle schedule(chrono::duration<Rep, Period> const & interval_, Task::FuncType func_, std::uintmax_t repeatCount_ = 1)
 	{
 		assert(repeatCount_ > 0);
-		return this->internalSchedule(chrono::duration_cast<IUpdatable::Duration>(interval_), func_, repeatCount_);
+		return this->internalSchedule(chrono::duration_cast<IUpdatable::Duration>(interval_), std::move(func_), repeatCount_);
 	}
 
+	/// <summary>
+	/// Cancels the specified task. Does nothing if the handle is stale.
+	/// </summary>
+	/// <param name="task_">Handle to the task.</param>
+	/// <returns>
+	///		<c>true</c> if task was scheduled and got cancelled; otherwise, <c>false</c>.
+	/// </returns>
+	bool cancel(TaskHandle task_);
+
+	/// <summary>
+	/// Determines whether the specified task is still scheduled for execution.
+	/// </summary>
+	/// <param name="task_">Handle to the task.</param>
+	bool isScheduled(TaskHandle task_) const;
+
+	/// <summary>
+	/// Returns task the handle points to.
+	/// </summary>
+	/// <param name="task_">Handle to the task.</param>
+	/// <returns>
+	///		Pointer to the task or <c>nullptr</c> if the handle is stale.
+	/// </returns>
+	Task* get(TaskHandle task_);
+
+	/// <summary>
+	/// Returns task the handle points to.
+	/// </summary>
+	/// <param name="task_">Handle to the task.</param>
+	/// <returns>
+	///		Pointer to the task or <c>nullptr</c> if the handle is stale.
+	/// </returns>
+	Task const* get(TaskHandle task_) const;
+
+#ifdef SAMP_EDGENGINE_COROUTINES
+	/// <summary>
+	/// Starts the coroutine. It runs until its first suspension point and is then resumed by this scheduler.
+	/// </summary>
+	/// <param name="coroutine_">The coroutine.</param>
+	/// <returns>Handle to the coroutine. Stale once the coroutine ends.</returns>
+	/// <remarks>
+	/// <para>Coroutine occupies a task slot, so it can be cancelled with <see cref="cancel"/> (which destroys the suspended frame)
+	///	and bound to an <see cref="ITaskOwner"/>, f.e. a player it refers to.</para>
+	/// </remarks>
+	TaskHandle start(Coroutine coroutine_);
+
+	/// <summary>
+	/// Starts the coroutine and binds it to the owner. Coroutine is cancelled when the owner is destroyed.
+	/// </summary>
+	/// <param name="owner_">The owner.</param>
+	/// <param name="coroutine_">The coroutine.</param>
+	/// <returns>Handle to the coroutine. Stale once the coroutine ends.</returns>
+	TaskHandle start(ITaskOwner & owner_, Coroutine coroutine_);
+
+	/// <summary>
+	/// Resumes the coroutine during first update after specified time point.
+	/// </summary>
+	/// <param name="timePoint_">The time point.</param>
+	/// <param name="coroutine_">Handle to the suspended coroutine.</param>
+	void resumeAt(IUpdatable::TimePoint timePoint_, TaskHandle coroutine_);
+
+	/// <summary>
+	/// Resumes the coroutine during next update.
+	/// </summary>
+	/// <param name="coroutine_">Handle to the suspended coroutine.</param>
+	void resumeNextTick(TaskHandle coroutine_);
+
+	// Called when coroutine ends with an exception. The coroutine frame is already destroyed.
+	EventDispatcher<std::exception_ptr> onCoroutineException;
+#endif
+
 	/// <summary>
 	/// Updates object every frame.
 	/// </summary>
@@ -145,17 +305,77 @@ public:
 	virtual void update(double deltaTime_, IUpdatable::TimePoint timeMoment_) override;
 
 private:
-	using ContainerType = std::vector<SharedPtr<Task>>;
-	
+	/// <summary>
+	/// Single entry of the execution queue.
+	/// </summary>
+	struct QueueEntry
+	{
+		IUpdatable::TimePoint	executionTime;
+		TaskHandle				task;
+	};
+
+	using PoolType		= std::deque<Task>;		// std::deque keeps slot addresses stable when the pool grows.
+	using ContainerType = std::vector<QueueEntry>;
+
 	/// <summary>
 	/// Schedules task with specified parameters. Internal implementation of the schedule funtion.
 	/// </summary>
 	/// <param name="interval_">The interval.</param>
 	/// <param name="func_">The function to be executed.</param>
 	/// <param name="repeatCount_">The repeat count.</param>
-	/// <returns>Shared pointer to the scheduled task.</returns>
-	SharedPtr<Task> internalSchedule(IUpdatable::Duration interval_, Task::FuncType func_, std::uintmax_t repeatCount_);
+	/// <returns>Handle to the scheduled task.</returns>
+	TaskHandle internalSchedule(IUpdatable::Duration interval_, Task::FuncType func_, std::uintmax_t repeatCount_);
+
+	/// <summary>
+	/// Takes a slot from the free list (or grows the pool).
+	/// </summary>
+	std::uint32_t acquireSlot();
+
+	/// <summary>
+	/// Returns the slot to the free list and invalidates every handle pointing to it.
+	/// </summary>
+	void releaseSlot(std::uint32_t index_);
+
+	/// <summary>
+	/// Pushes an entry to the execution queue (min-heap on execution time).
+	/// </summary>
+	void enqueue(QueueEntry entry_);
+
+#ifdef SAMP_EDGENGINE_COROUTINES
+	/// <summary>
+	/// Resumes every coroutine that is ready.
+	/// </summary>
+	void resumeCoroutines(IUpdatable::TimePoint timeMoment_);
+
+	/// <summary>
+	/// Resumes single coroutine. Destroys its frame and releases the slot once it ends or gets cancelled.
+	/// </summary>
+	/// <param name="coroutine_">Handle to the coroutine. Stale handles are ignored.</param>
+	void resumeCoroutine(TaskHandle coroutine_);
+
+	/// <summary>
+	/// Destroys the coroutine frame and releases the slot.
+	/// </summary>
+	/// <returns>Exception the coroutine ended with (if any).</returns>
+	std::exception_ptr destroyCoroutine(std::uint32_t index_);
+
+	/// <summary>
+	/// Single entry of the sleeping coroutine queue.
+	/// </summary>
+	struct SleepingCoroutine
+	{
+		IUpdatable::TimePoint	wakeTime;
+		TaskHandle				coroutine;
+	};
+
+	std::vector<SleepingCoroutine>	m_sleepingCoroutines;	// Min-heap on wake time.
+	std::vector<TaskHandle>			m_nextTickCoroutines;
+	std::vector<TaskHandle>			m_resumedCoroutines;	// Buffer reused every update.
+#endif
 
+	PoolType		m_pool;
+	std::uint32_t	m_firstFree;
+	std::uint32_t	m_executedSlot;				// Slot of the task (or coroutine) being executed right now. Its release must be postponed.
 	ContainerType	m_tasks;
 	bool			m_performsTaskExecution;	// A state that informs whether tasks are now being executed and scheduling tasks will most probably invalidate iterators.
 	ContainerType	m_pendingTasks;				// Tasks that were added during invoking. They must be added after the execution.
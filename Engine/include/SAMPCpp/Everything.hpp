@@ -12,6 +12,7 @@
 
 // Core/:
 #include <SAMPCpp/Core/TaskSystem.hpp>
+#include <SAMPCpp/Core/Coroutine.hpp>
 #include <SAMPCpp/Core/Events.hpp>
 #include <SAMPCpp/Core/Clock.hpp>
 #include <SAMPCpp/Core/Color.hpp>
@@ -19,6 +20,7 @@
 #include <SAMPCpp/Core/Pointers.hpp>
 #include <SAMPCpp/Core/TypeTraits.hpp>
 #include <SAMPCpp/Core/Log.hpp>
+#include <SAMPCpp/Core/MainThreadQueue.hpp>
 
 
 #include <SAMPCpp/Core/TextInc.hpp>
@@ -28,16 +30,23 @@
 
 // World/:
 #include <SAMPCpp/World/MapObject.hpp>
+#include <SAMPCpp/World/ObjectMotion.hpp>
+#include <SAMPCpp/World/MaterialTable.hpp>
 #include <SAMPCpp/World/Scene.hpp>
 #include <SAMPCpp/World/Vehicle.hpp>
 #include <SAMPCpp/World/Map.hpp>
+#include <SAMPCpp/World/RemovedBuildingSet.hpp>
 #include <SAMPCpp/World/GangZone.hpp>
 #include <SAMPCpp/World/Checkpoint.hpp>
 #include <SAMPCpp/World/RaceCheckpoint.hpp>
+#include <SAMPCpp/World/CheckpointSet.hpp>
+#include <SAMPCpp/World/Region.hpp>
+#include <SAMPCpp/World/RegionTriggers.hpp>
 
 // --> World/MapObject/:
 #include <SAMPCpp/World/GlobalObject.hpp>
 #include <SAMPCpp/World/PersonalObject.hpp>
+#include <SAMPCpp/World/PersonalObjectBatch.hpp>
 #include <SAMPCpp/World/UniversalObject.hpp>
 
 // --> World/Streamer/:
@@ -55,6 +64,7 @@
 #include <SAMPCpp/Server/GameMode.hpp>
 #include <SAMPCpp/Server/GameModeChild.hpp>
 #include <SAMPCpp/Server/Server.hpp>
+#include <SAMPCpp/Server/FramePipeline.hpp>
 #include <SAMPCpp/Server/TextDraw.hpp>
 #include <SAMPCpp/Server/PlayerTextDraw.hpp>
 #include <SAMPCpp/Server/GlobalTextDraw.hpp>
@@ -71,6 +81,10 @@
 // --> Server/Player:
 #include <SAMPCpp/Server/Player.hpp>
 #include <SAMPCpp/Server/PlayerPool.hpp>
+#include <SAMPCpp/Server/PlayerNameIndex.hpp>
+#include <SAMPCpp/Server/PlayerStateSnapshot.hpp>
+#include <SAMPCpp/Server/NameTagMatrix.hpp>
+#include <SAMPCpp/Server/PlayerAttachments.hpp>
 #include <SAMPCpp/Server/Weapon.hpp>
 #include <SAMPCpp/Server/Teleport.hpp>
 
@@ -0,0 +1,199 @@
+// File description:
+// Implements phase-based server frame pipeline.
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+#include <SAMPCpp/Core/Events.hpp>
+#include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
+
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Phases of a single server frame, in order of execution.
+/// </summary>
+enum class FramePhase
+{
+	Input,			// Processing data received from clients (checkpoint intersection, posted events, etc.).
+	Simulation,		// Game logic: tasks, game mode (`ServerClass::onServerUpdate`).
+	Streaming,		// Streamer.
+	Output			// Sending data to clients.
+};
+
+/// <summary>
+/// Runs every frame phase in fixed order and measures how long each one takes.
+/// </summary>
+/// <remarks>
+/// <para>Systems register to a phase the same way as to any other event:</para>
+/// <code>
+///		Server->pipeline[FramePhase::Streaming] += { *this, &MyStreamer::update };
+/// </code>
+/// <para>Handlers of a single phase are invoked in subscription order.</para>
+/// <para>Heavy systems can use <see cref="getRemainingBudget"/> to throttle their work.</para>
+/// </remarks>
+class FramePipeline
+{
+public:
+	// Aliases:
+	using Duration			= IUpdatable::Duration;
+	using PhaseDispatcher	= EventDispatcher<double, IUpdatable::TimePoint>;
+
+	constexpr static std::size_t PhaseCount = 4;
+
+	/// <summary>
+	/// Timing statistics of a single phase.
+	/// </summary>
+	struct PhaseStats
+	{
+		Duration		budget			= Duration::zero();	// Zero means no budget.
+		Duration		lastDuration	= Duration::zero();
+		Duration		maxDuration		= Duration::zero();
+		std::uint64_t	overrunCount	= 0;
+	};
+
+	/// <summary>
+	/// Returns dispatcher of the specified phase.
+	/// </summary>
+	/// <param name="phase_">The phase.</param>
+	PhaseDispatcher& operator[](FramePhase phase_) {
+		return m_phases[static_cast<std::size_t>(phase_)].dispatcher;
+	}
+
+	/// <summary>
+	/// Starts new frame (increments frame number).
+	/// </summary>
+	void beginFrame() {
+		++m_frameNumber;
+	}
+
+	/// <summary>
+	/// Returns number of the current frame. First frame has number 1.
+	/// </summary>
+	std::uint64_t getFrameNumber() const {
+		return m_frameNumber;
+	}
+
+	/// <summary>
+	/// Runs specified phase: engine routine first, then every registered handler.
+	/// </summary>
+	/// <param name="phase_">The phase.</param>
+	/// <param name="deltaTime_">Number of seconds passed since last update.</param>
+	/// <param name="frameTime_">The point of time in which update happened.</param>
+	/// <param name="engineRoutine_">Built-in engine work that belongs to this phase.</param>
+	/// <remarks>
+	/// <para>If the routine or a handler throws, the phase is abandoned without updating its stats,
+	///	so the next frame can run normally.</para>
+	/// </remarks>
+	template <typename TEngineRoutine>
+	void runPhase(FramePhase phase_, double deltaTime_, IUpdatable::TimePoint frameTime_, TEngineRoutine && engineRoutine_)
+	{
+		this->beginPhase(phase_);
+		PhaseGuard guard{ this };
+
+		engineRoutine_();
+		m_phases[static_cast<std::size_t>(phase_)].dispatcher.emit(deltaTime_, frameTime_);
+
+		guard.pipeline = nullptr;
+		this->endPhase();
+	}
+
+	/// <summary>
+	/// Runs specified phase.
+	/// </summary>
+	/// <param name="phase_">The phase.</param>
+	/// <param name="deltaTime_">Number of seconds passed since last update.</param>
+	/// <param name="frameTime_">The point of time in which update happened.</param>
+	void runPhase(FramePhase phase_, double deltaTime_, IUpdatable::TimePoint frameTime_)
+	{
+		this->runPhase(phase_, deltaTime_, frameTime_, []{});
+	}
+
+	/// <summary>
+	/// Sets time budget of the specified phase.
+	/// </summary>
+	/// <param name="phase_">The phase.</param>
+	/// <param name="budget_">The budget. Zero disables overrun detection.</param>
+	template <typename Rep, typename Period>
+	void setBudget(FramePhase phase_, chrono::duration<Rep, Period> const & budget_)
+	{
+		m_phases[static_cast<std::size_t>(phase_)].stats.budget = chrono::duration_cast<Duration>(budget_);
+	}
+
+	/// <summary>
+	/// Returns time left from the budget of currently running phase.
+	/// </summary>
+	/// <returns>
+	///		Remaining budget; <c>Duration::max()</c> if phase has no budget or no phase is running.
+	/// </returns>
+	Duration getRemainingBudget() const;
+
+	/// <summary>
+	/// Returns currently running phase.
+	/// </summary>
+	std::optional<FramePhase> getCurrentPhase() const {
+		return m_currentPhase;
+	}
+
+	/// <summary>
+	/// Returns timing statistics of the specified phase.
+	/// </summary>
+	/// <param name="phase_">The phase.</param>
+	PhaseStats const& getStats(FramePhase phase_) const {
+		return m_phases[static_cast<std::size_t>(phase_)].stats;
+	}
+
+	/// <summary>
+	/// Resets maximal duration and overrun count of every phase.
+	/// </summary>
+	void resetStats();
+
+	/// <summary>
+	/// Returns name of the specified phase.
+	/// </summary>
+	/// <param name="phase_">The phase.</param>
+	static std::string_view getPhaseName(FramePhase phase_);
+
+	// Called when phase took longer than its budget. Params: phase, measured duration, budget.
+	EventDispatcher<FramePhase, Duration, Duration> onPhaseOverrun;
+
+private:
+	/// <summary>
+	/// Starts measuring the phase.
+	/// </summary>
+	void beginPhase(FramePhase phase_);
+
+	/// <summary>
+	/// Stops measuring current phase, updates its stats and detects overrun.
+	/// </summary>
+	void endPhase();
+
+	/// <summary>
+	/// Abandons current phase if it was not ended (f.e. when handler throws).
+	/// </summary>
+	struct PhaseGuard
+	{
+		FramePipeline* pipeline;
+
+		~PhaseGuard() {
+			if (pipeline)
+				pipeline->m_currentPhase.reset();
+		}
+	};
+
+	struct Phase
+	{
+		PhaseDispatcher	dispatcher;
+		PhaseStats		stats;
+	};
+
+	std::array<Phase, PhaseCount>	m_phases;
+	std::optional<FramePhase>		m_currentPhase;
+	IUpdatable::TimePoint			m_phaseStart;
+	std::uint64_t					m_frameNumber = 0;
+};
+
+}
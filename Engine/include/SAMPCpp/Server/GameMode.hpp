@@ -14,6 +14,7 @@
 #include <SAMPCpp/Server/GlobalTextDraw.hpp>
 #include <SAMPCpp/Server/TextDrawOwner.hpp>
 #include <SAMPCpp/World/Map.hpp>
+#include <SAMPCpp/World/RegionTriggers.hpp>
 
 #include <SAMPCpp/Core/BasicInterfaces/Streamer.hpp>
 #include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
@@ -96,10 +97,19 @@ protected:
 
 	virtual void onServerUpdate(double deltaTime_, IUpdatable::TimePoint timePoint_);
 
+#ifdef SAMP_EDGENGINE_COROUTINES
+	/// <summary>
+	/// Called when scripted sequence ends with an exception. Logs the exception by default.
+	/// </summary>
+	/// <param name="exception_">The exception.</param>
+	virtual void onCoroutineException(std::exception_ptr exception_);
+#endif
+
 public:
+	TaskScheduler			tasks;		// Declared first so it outlives every ITaskOwner (e.g. players).
 	PlayerPool				players;
 	MapClass				map;
-	TaskScheduler			tasks;
+	RegionTriggers			regions;
 
 #ifdef DEBUG
 	Log						debugLog;
@@ -0,0 +1,116 @@
+// File description:
+// Implements name tag visibility of every pair of players.
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+#include <SAMPCpp/Dependencies/SampGDK.hpp>
+
+#include <bitset>
+
+namespace samp_cpp
+{
+
+class PlayerPool;
+
+/// <summary>
+/// Stores desired and current (sent to clients) name tag visibility of every pair of players.
+/// </summary>
+/// <remarks>
+/// <para>Changing visibility only updates desired state. <see cref="update"/> sends natives
+///	for pairs that differ from the current state, at most <see cref="getCallBudget"/> per call,
+///	so large changes are spread over several ticks.</para>
+/// <para>Visibility set for everyone applies to players that connect later too.</para>
+/// </remarks>
+class NameTagMatrix
+{
+public:
+	constexpr static std::size_t MaxSlots			= MAX_PLAYERS;
+	constexpr static std::size_t DefaultCallBudget	= 2048;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="NameTagMatrix"/> class.
+	/// </summary>
+	NameTagMatrix();
+
+	/// <summary>
+	/// Sets whether viewer sees name tag of the target.
+	/// </summary>
+	/// <param name="viewerIndex_">Index of the viewer.</param>
+	/// <param name="targetIndex_">Index of the target (name tag owner).</param>
+	/// <param name="visible_">if set to <c>true</c> name tag is visible.</param>
+	void setVisible(std::size_t viewerIndex_, std::size_t targetIndex_, bool visible_);
+
+	/// <summary>
+	/// Sets whether everyone sees name tag of the target.
+	/// </summary>
+	/// <param name="targetIndex_">Index of the target (name tag owner).</param>
+	/// <param name="visible_">if set to <c>true</c> name tag is visible.</param>
+	void setVisibleForEveryone(std::size_t targetIndex_, bool visible_);
+
+	/// <summary>
+	/// Determines whether viewer sees (or will see after update) name tag of the target.
+	/// </summary>
+	/// <param name="viewerIndex_">Index of the viewer.</param>
+	/// <param name="targetIndex_">Index of the target (name tag owner).</param>
+	/// <returns>
+	///		<c>true</c> if name tag is visible; otherwise, <c>false</c>.
+	/// </returns>
+	bool isVisible(std::size_t viewerIndex_, std::size_t targetIndex_) const {
+		return m_desired[targetIndex_].test(viewerIndex_);
+	}
+
+	/// <summary>
+	/// Sends visibility of pairs that changed, within the call budget.
+	/// </summary>
+	/// <param name="players_">The player pool.</param>
+	void update(PlayerPool const & players_);
+
+	/// <summary>
+	/// Sets maximal number of natives called by single update.
+	/// </summary>
+	/// <param name="callBudget_">The budget.</param>
+	void setCallBudget(std::size_t callBudget_) {
+		m_callBudget = std::max<std::size_t>(callBudget_, 1);
+	}
+
+	/// <summary>
+	/// Returns maximal number of natives called by single update.
+	/// </summary>
+	std::size_t getCallBudget() const {
+		return m_callBudget;
+	}
+
+	/// <summary>
+	/// Returns number of targets with visibility changes not sent yet.
+	/// </summary>
+	std::size_t getPendingTargetCount() const {
+		return m_dirtyTargets.count();
+	}
+
+	/// <summary>
+	/// Called when player connects.
+	/// </summary>
+	/// <param name="playerIndex_">Index of the player.</param>
+	void whenPlayerConnects(std::size_t playerIndex_);
+
+	/// <summary>
+	/// Called when player disconnects.
+	/// </summary>
+	/// <param name="playerIndex_">Index of the player.</param>
+	void whenPlayerDisconnects(std::size_t playerIndex_);
+
+private:
+	using Row = std::bitset<MaxSlots>;	// Bit per viewer.
+
+	std::vector<Row>	m_desired;			/// Desired visibility, row per target.
+	std::vector<Row>	m_current;			/// Visibility sent to clients, row per target.
+	Row					m_hiddenForEveryone;	/// Targets hidden for every (also future) viewer.
+	Row					m_dirtyTargets;		/// Targets whose rows may differ.
+	std::size_t			m_cursor;			/// Target to resume update from.
+	std::size_t			m_callBudget;
+};
+
+}
@@ -19,10 +19,13 @@
 #include <SAMPCpp/Core/TypesAndDefinitions.hpp>
 #include <SAMPCpp/World/Checkpoint.hpp>
 #include <SAMPCpp/World/RaceCheckpoint.hpp>
+#include <SAMPCpp/World/CheckpointSet.hpp>
 #include <SAMPCpp/Server/PlayerTextDraw.hpp>
 #include <SAMPCpp/Server/Dialog.hpp>
 #include <SAMPCpp/Server/Teleport.hpp>
 #include <SAMPCpp/Server/PlayerEnums.hpp>
+#include <SAMPCpp/Server/PlayerStateSnapshot.hpp>
+#include <SAMPCpp/Server/PlayerAttachments.hpp>
 
 #include <SAMPCpp/Server/Interfaces/ServerDebugLogReceiver.hpp>
 
@@ -32,6 +35,7 @@ class RaceCheckpoint;
 class Checkpoint;
 class Vehicle;
 class IGameMode;
+class PersonalObjectBatch;
 
 /// <summary>
 /// Wraps SAMP player data into class.
@@ -276,6 +280,18 @@ public:
 	/// <param name="personalObject_">The only owning pointer to vehicle.</param>
 	/// <returns>Reference to created vehicle.</returns>
 	PersonalObject& finalizePersonalObjectConstruction(UniquePtr< PersonalObject > && personalObject_);
+
+	/// <summary>
+	/// Constructs every personal object described by the batch.
+	/// </summary>
+	/// <param name="batch_">The batch.</param>
+	/// <returns>Pointers to the constructed objects, in batch order.</returns>
+	/// <remarks>
+	/// <para>Storage is grown once and objects join the streamer in a single bulk insertion
+	///	(see <see cref="IStreamer::whenObjectsJoinMap"/>), which evaluates the player's visibility once,
+	///	so spawning whole maps (races, interiors) does not reallocate nor restream per object.</para>
+	/// </remarks>
+	std::vector<PersonalObject*> constructPersonalObjects(PersonalObjectBatch const & batch_);
 	
 	/// <summary>
 	/// Removes the personal object.
@@ -567,6 +583,10 @@ public:
 	/// Returns the player location.
 	/// </summary>
 	/// <returns>Player location.</returns>
+	/// <remarks>
+	/// <para>Transform getters read the state snapshot (see <c>getState</c>) and call natives
+	///	only when the matching field was invalidated by a setter.</para>
+	/// </remarks>
 	virtual math::Vector3f getLocation() const override;
 
 	/// <summary>
@@ -690,6 +710,45 @@ public:
 	/// <returns>Player's weapon set.</returns>
 	WeaponSet getWeaponSet() const;
 
+	/// <summary>
+	/// Returns weapon the player holds.
+	/// </summary>
+	/// <returns>Weapon in hand.</returns>
+	/// <remarks>
+	/// <para>Read from the state snapshot, like the transform getters.</para>
+	/// </remarks>
+	Weapon::Type getWeapon() const;
+
+	/// <summary>
+	/// Returns player special action (SPECIAL_ACTION_* constant).
+	/// </summary>
+	/// <returns>Special action.</returns>
+	/// <remarks>
+	/// <para>Read from the state snapshot, like the transform getters.</para>
+	/// </remarks>
+	Int32 getSpecialAction() const;
+
+	/// <summary>
+	/// Returns keys pressed by the player.
+	/// </summary>
+	/// <returns>Pressed keys.</returns>
+	/// <remarks>
+	/// <para>Read from the state snapshot, like the transform getters.</para>
+	/// </remarks>
+	PlayerStateSnapshot::KeyState getKeys() const;
+
+	/// <summary>
+	/// Returns player state read from the client during current (or recent) frame.
+	/// </summary>
+	/// <returns>Player state snapshot.</returns>
+	/// <remarks>
+	/// <para>Reading the snapshot does not call any natives. Use it in code that checks player state
+	///	frequently (f.e. anti-cheat, HUD) and check field age if exact value matters.</para>
+	/// </remarks>
+	PlayerStateSnapshot const& getState() const noexcept {
+		return m_state;
+	}
+
 	// Player status.
 
 	/// <summary>
@@ -757,12 +816,20 @@ public:
 	/// </summary>
 	void sendPlacementUpdate(PlayerPlacement const customPlacement_);
 
+	// Objects attached to the player.
+	PlayerAttachments	attachments;
+
+	// Checkpoints streamed to the player (used instead of map checkpoints when not empty).
+	PlayerCheckpointSet		checkpoints;
+	PlayerRaceCheckpointSet	raceCheckpoints;
+
 	friend class ServerClass;
 	friend class MapClass;
 	friend class IStreamer;
 	friend class PlayerTextDraw;
 	friend class IGameMode;
 	friend class Vehicle;
+	friend class PlayerPool;
 protected:
 				
 	/// <summary>
@@ -815,6 +882,36 @@ private:
 		m_insideRaceCheckpoint = inside_;
 	}
 
+	/// <summary>
+	/// State written to the client by setters (used by write combining).
+	/// </summary>
+	enum PendingWrite : Uint8
+	{
+		HealthWrite	= 1 << 0,
+		ArmourWrite	= 1 << 1,
+		ColorWrite	= 1 << 2,
+		ScoreWrite	= 1 << 3,
+		CashWrite	= 1 << 4
+	};
+
+	/// <summary>
+	/// Sends the state to the client right away or, if write combining is on, marks it as pending.
+	/// </summary>
+	/// <param name="write_">The state.</param>
+	void recordWrite(PendingWrite write_);
+
+	/// <summary>
+	/// Sends every pending state to the client.
+	/// </summary>
+	void flushWrites();
+
+	/// <summary>
+	/// Sends the state to the client.
+	/// </summary>
+	/// <param name="write_">The state.</param>
+	/// <param name="skipUnchanged_">if set to <c>true</c> skips the native if client already has the value.</param>
+	void applyWrite(PendingWrite write_, bool skipUnchanged_);
+
 	/// <summary>
 	/// Sets whether the player is spawned or not.
 	/// </summary>
@@ -854,13 +951,21 @@ private:
 	float				m_health;			/// Player's in-game health.
 	float				m_armour;			/// Player's in-game armour.
 	Vehicle*			m_vehicle;			/// Vehicle player sits in.
+	Color				m_color;			/// Player's color (valid only when write is pending).
+
+	// Write combining.
+	Uint8					m_pendingWrites = 0;	/// Bit set of PendingWrite.
+	std::optional<float>	m_sentHealth;			/// Last health sent to the client.
+	std::optional<float>	m_sentArmour;			/// Last armour sent to the client.
+	std::optional<Int32>	m_sentColor;			/// Last color sent to the client.
+	std::optional<Int32>	m_sentScore;			/// Last score sent to the client.
 
 	Player* 			m_latestAttacker 		= nullptr;
 	Weapon::Type		m_latestAttackerWeapon 	= Weapon::Fist;
 	std::chrono::steady_clock::time_point m_latestWoundedTime;
 
 	Clock::TimePoint 	m_unfreezeTime;
-	SharedPtr<Task>		m_unfreezeTask;
+	TaskHandle			m_unfreezeTask;
 
 	// Player personal settings:
 	Uint16				m_language;			/// Player's language.
@@ -868,6 +973,9 @@ private:
 	// Tracking:
 	I3DNodePlacementTracker* m_placementTracker;
 
+	// Client state, read once per frame.
+	PlayerStateSnapshot	m_state;
+
 	// Dialog:
 	UniquePtr<IDialog>	m_dialog;
 
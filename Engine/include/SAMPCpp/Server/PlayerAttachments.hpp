@@ -0,0 +1,119 @@
+// File description:
+// Implements management of objects attached to the player.
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+#include <SAMPCpp/Core/Color.hpp>
+
+#include <SAMPCpp/Dependencies/QuickMaffs.hpp>
+#include <SAMPCpp/Dependencies/SampGDK.hpp>
+
+namespace samp_cpp
+{
+
+class Player;
+
+/// <summary>
+/// Object attached to the player (single slot).
+/// </summary>
+struct AttachedObject
+{
+	Int32			modelIndex		= 0;
+	Int32			bone			= 0;
+	math::Vector3f	offset			= {};
+	math::Vector3f	rotation		= {};
+	math::Vector3f	scale			= { 1.f, 1.f, 1.f };
+	Int32			materialColor1	= 0;
+	Int32			materialColor2	= 0;
+
+	bool operator==(AttachedObject const & rhs_) const;
+	bool operator!=(AttachedObject const & rhs_) const {
+		return !(*this == rhs_);
+	}
+};
+
+/// <summary>
+/// Tracks attached object slots of the player and sends only the changes.
+/// </summary>
+/// <remarks>
+/// <para>Setting a slot to the object it already has does not call any natives.</para>
+/// <para>SA-MP streams attached objects together with the owner, to every player that streams the owner,
+///	so they cannot be hidden for selected viewers.</para>
+/// </remarks>
+class PlayerAttachments
+{
+public:
+	constexpr static std::size_t SlotCount = MAX_PLAYER_ATTACHED_OBJECTS;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="PlayerAttachments"/> class.
+	/// </summary>
+	/// <param name="owner_">The owner.</param>
+	explicit PlayerAttachments(Player & owner_);
+
+	/// <summary>
+	/// Attaches the object in specified slot.
+	/// </summary>
+	/// <param name="slotIndex_">Index of the slot.</param>
+	/// <param name="object_">The object.</param>
+	void set(std::size_t slotIndex_, AttachedObject const & object_);
+
+	/// <summary>
+	/// Removes the object from specified slot.
+	/// </summary>
+	/// <param name="slotIndex_">Index of the slot.</param>
+	void remove(std::size_t slotIndex_);
+
+	/// <summary>
+	/// Removes every attached object.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns object attached in specified slot.
+	/// </summary>
+	/// <param name="slotIndex_">Index of the slot.</param>
+	/// <returns>The object. Empty if slot is free or index is invalid.</returns>
+	std::optional<AttachedObject> const& get(std::size_t slotIndex_) const;
+
+	/// <summary>
+	/// Determines whether any slot is used.
+	/// </summary>
+	bool isEmpty() const;
+
+	/// <summary>
+	/// Sends every used slot again. Use when client lost attached objects (f.e. respawn, skin change).
+	/// </summary>
+	void reapply();
+
+	/// <summary>
+	/// Sends specified slot again. Use when client lost a single attached object (f.e. cancelled edition).
+	/// </summary>
+	/// <param name="slotIndex_">Index of the slot.</param>
+	void reapplySlot(std::size_t slotIndex_);
+
+	/// <summary>
+	/// Called when player finished editing attached object.
+	/// </summary>
+	/// <param name="slotIndex_">Index of the slot.</param>
+	/// <param name="object_">Edited object (client already has it).</param>
+	void whenEdited(std::size_t slotIndex_, AttachedObject const & object_);
+
+private:
+	/// <summary>
+	/// Sends the slot if its state differs from the applied one.
+	/// </summary>
+	/// <param name="slotIndex_">Index of the slot.</param>
+	void applySlot(std::size_t slotIndex_);
+
+	using Slots = std::array<std::optional<AttachedObject>, SlotCount>;
+
+	Player&		m_owner;
+	Slots		m_desired;		/// Slots set by the game mode.
+	Slots		m_applied;		/// Slots sent to the client.
+};
+
+}
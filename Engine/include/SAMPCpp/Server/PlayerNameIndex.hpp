@@ -0,0 +1,95 @@
+// File description:
+// Implements index of player names used by the PlayerPool lookups.
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <unordered_map>
+
+namespace samp_cpp
+{
+
+class Player;
+
+/// <summary>
+/// Case-insensitive index of player names.
+/// </summary>
+/// <remarks>
+/// <para>Exact lookups use a hash map. Partial ("best match") and prefix lookups binary search
+///	a sorted array of every suffix of every name, so they do not depend on the number of players.</para>
+/// </remarks>
+class PlayerNameIndex
+{
+public:
+	/// <summary>
+	/// Initializes a new instance of the <see cref="PlayerNameIndex"/> class.
+	/// </summary>
+	/// <param name="maxPlayers_">Maximal number of players.</param>
+	explicit PlayerNameIndex(std::size_t maxPlayers_);
+
+	/// <summary>
+	/// Adds player to the index.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	/// <param name="name_">Name of the player.</param>
+	void insert(Player & player_, std::string_view const name_);
+
+	/// <summary>
+	/// Removes player from the index.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	void remove(Player const & player_);
+
+	/// <summary>
+	/// Updates name of the player.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	/// <param name="newName_">New name of the player.</param>
+	void rename(Player & player_, std::string_view const newName_);
+
+	/// <summary>
+	/// Finds player with exactly the same name (case insensitive).
+	/// </summary>
+	/// <param name="name_">The name.</param>
+	/// <returns>Player with specified name. May be null pointer.</returns>
+	Player* findExact(std::string_view const name_) const;
+
+	/// <summary>
+	/// Finds player whose name contains the longest prefix of specified fragment (case insensitive).
+	/// </summary>
+	/// <param name="fragment_">The searched fragment.</param>
+	/// <param name="minimalScore_">Minimal length of the matching prefix.</param>
+	/// <returns>Best matching player (lowest index if many match equally). May be null pointer.</returns>
+	Player* findBestMatch(std::string_view const fragment_, std::size_t const minimalScore_) const;
+
+	/// <summary>
+	/// Finds every player whose name starts with specified prefix (case insensitive).
+	/// </summary>
+	/// <param name="prefix_">The prefix.</param>
+	/// <returns>Players with matching names.</returns>
+	std::vector<Player*> findByPrefix(std::string_view const prefix_) const;
+
+private:
+	/// <summary>
+	/// Single suffix of an indexed name.
+	/// </summary>
+	struct Suffix
+	{
+		std::string_view	text;		// Points into m_lowerNames.
+		std::size_t			offset;		// Offset of the suffix inside name.
+		Player*				player;
+	};
+
+	/// <summary>
+	/// Orders suffixes by text, then by player index.
+	/// </summary>
+	static bool suffixLess(Suffix const & lhs_, Suffix const & rhs_);
+
+	std::vector<std::string>						m_lowerNames;	// Lower case names, indexed by player index.
+	std::vector<bool>								m_indexed;		// Whether player with index is in the index.
+	std::unordered_map<std::string_view, Player*>	m_exact;		// Keys point into m_lowerNames.
+	std::vector<Suffix>								m_suffixes;		// Sorted with suffixLess.
+};
+
+}
@@ -8,6 +8,9 @@
 // Custom includes:
 #include <SAMPCpp/Server/Player.hpp>
 #include <SAMPCpp/Core/Pointers.hpp>
+#include <SAMPCpp/Core/Container/SpatialHashGrid.hpp>
+#include <SAMPCpp/Server/PlayerNameIndex.hpp>
+#include <SAMPCpp/Server/NameTagMatrix.hpp>
 
 namespace samp_cpp
 {		
@@ -16,12 +19,24 @@ class ServerClass;
 /// <summary>
 /// Stores every player in game.
 /// </summary>
+/// <remarks>
+/// <para>Spatial queries (findEveryoneInRadius, findNearest, findKNearest) use player locations
+///	cached once per tick (see <see cref="refreshSpatialIndex"/>), so they do not call any natives.</para>
+/// <para>Players are stored in a fixed array of MAX_PLAYERS slots (indexed with player index), connected ones
+///	are additionally kept in a dense list. Removing player from the list swaps it with the last one,
+///	so order of <see cref="getPool"/> is not the order of connection.</para>
+/// <para>Name lookups (findByName, findBestMatch, findByNamePrefix) use <see cref="PlayerNameIndex"/>,
+///	maintained when player connects, disconnects or changes name.</para>
+/// </remarks>
 class PlayerPool final
 {
 public:
-	using PoolType			= std::vector< SharedPtr< Player > >;
 	using RawPoolType		= std::vector< Player * >;
 
+	constexpr static std::size_t MaxSlots = MAX_PLAYERS;
+
+	constexpr static float SpatialIndexCellSize = 50.f;
+
 	/// <summary>
 	/// Initializes a new instance of the <see cref="PlayerPool"/> class.
 	/// </summary>
@@ -86,6 +101,70 @@ public:
 	/// <returns>Nearest player within the radius from specified location. May be null pointer.</returns>
 	Player* findNearest(Player const *const player_, math::Meters const radius_);
 
+	/// <summary>
+	/// Finds up to `count_` players nearest to specified location.
+	/// </summary>
+	/// <param name="location_">The location.</param>
+	/// <param name="count_">Maximal number of players.</param>
+	/// <param name="radius_">The radius.</param>
+	/// <returns>Players within the radius, sorted by distance (nearest first).</returns>
+	RawPoolType findKNearest(math::Vector3f const location_, std::size_t const count_, math::Meters const radius_);
+
+	/// <summary>
+	/// Reads location of every connected player and rebuilds the spatial index.
+	/// </summary>
+	/// <remarks>
+	/// <para>Called by the server once per tick (FramePhase::Input).</para>
+	/// </remarks>
+	void refreshSpatialIndex();
+
+	/// <summary>
+	/// Returns location player is indexed with (read during last <see cref="refreshSpatialIndex"/>).
+	/// </summary>
+	/// <param name="playerIndex_">Index of the player.</param>
+	/// <returns>Indexed location. Empty if player is not indexed.</returns>
+	std::optional<math::Vector3f> getIndexedLocation(std::size_t const playerIndex_) const {
+		return playerIndex_ < m_indexedLocations.size() ? m_indexedLocations[playerIndex_] : std::nullopt;
+	}
+
+	/// <summary>
+	/// Reads state snapshot of every player that sent an update since last refresh.
+	/// </summary>
+	/// <param name="frame_">Current frame number.</param>
+	/// <remarks>
+	/// <para>Called by the server once per tick (FramePhase::Input).</para>
+	/// </remarks>
+	void refreshStateSnapshots(PlayerStateSnapshot::FrameNumber frame_);
+
+	/// <summary>
+	/// Turns write combining on or off.
+	/// </summary>
+	/// <param name="enabled_">if set to <c>true</c> write combining is on.</param>
+	/// <remarks>
+	/// <para>When write combining is on, setters of health, armour, color, score and cash only store the value.
+	///	Values are sent once, at the end of the frame (FramePhase::Output), and only if client does not have them already.</para>
+	/// <para>Turning it off flushes every pending write.</para>
+	/// </remarks>
+	void setWriteCombining(bool enabled_);
+
+	/// <summary>
+	/// Determines whether write combining is on.
+	/// </summary>
+	/// <returns>
+	///		<c>true</c> if write combining is on; otherwise, <c>false</c>.
+	/// </returns>
+	bool isWriteCombiningEnabled() const {
+		return m_writeCombining;
+	}
+
+	/// <summary>
+	/// Sends every pending write to the clients.
+	/// </summary>
+	/// <remarks>
+	/// <para>Called by the server once per tick (FramePhase::Output).</para>
+	/// </remarks>
+	void flushPendingWrites();
+
 	/// <summary>
 	/// Finds the player by name.
 	/// </summary>
@@ -120,6 +199,30 @@ public:
 	/// </remarks>
 	Player* findBestMatch(std::string_view const nameOrIndex_, std::size_t const minimalScore_ = 2);
 
+	/// <summary>
+	/// Finds every player whose name starts with specified prefix (case insensitive).
+	/// </summary>
+	/// <param name="prefix_">The prefix.</param>
+	/// <returns>Players with matching names.</returns>
+	RawPoolType findByNamePrefix(std::string_view const prefix_) const;
+
+	/// <summary>
+	/// Returns name tag visibility of every pair of players.
+	/// </summary>
+	/// <remarks>
+	/// <para>Changes are sent to clients once per tick (FramePhase::Output).</para>
+	/// </remarks>
+	NameTagMatrix& getNameTags() {
+		return m_nameTags;
+	}
+
+	/// <summary>
+	/// Returns name tag visibility of every pair of players.
+	/// </summary>
+	NameTagMatrix const& getNameTags() const {
+		return m_nameTags;
+	}
+
 	/// <summary>
 	/// Gets the player pool (of raw pointers).
 	/// </summary>
@@ -149,6 +252,8 @@ public:
 
 	/// PlayerPoolAgent have access to some private members.
 	friend class ServerClass;
+	/// Player notifies the pool about name change.
+	friend class Player;
 private:
 
 	/// <summary>
@@ -170,11 +275,40 @@ private:
 	/// </remarks>
 	void whenPlayerDisconnectsEx(std::size_t const playerIndex_);
 
+	/// <summary>
+	/// Called when player's name changes.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	void whenPlayerNameChanges(Player & player_);
+
+	/// <summary>
+	/// Called when player records first pending write since last flush.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	void whenPlayerHasPendingWrites(Player & player_);
+
+	/// <summary>
+	/// Slot of a single player index.
+	/// </summary>
+	struct Slot
+	{
+		UniquePtr<Player>	player;
+		std::size_t			connectedIndex = 0;	/// Position inside m_connectedPlayers.
+	};
+
 	// Private members
-		
-	PoolType			m_playerPool;		/// Store Players in vector of shared pointers.
-	RawPoolType			m_playerRawPool;	/// Store raw pointers in this vector.
-	RawPoolType			m_connectedPlayers;	/// Store every connected player in this vector.
+
+	std::array<Slot, MaxSlots>	m_slots;			/// Store Players by their index.
+	RawPoolType					m_connectedPlayers;	/// Store every connected player in this (dense) vector.
+
+	SpatialHashGrid<Player*>					m_spatialIndex;			/// Player locations, refreshed once per tick.
+	std::vector< std::optional<math::Vector3f> >	m_indexedLocations;		/// Location each player is indexed with.
+	PlayerNameIndex								m_nameIndex;			/// Case-insensitive index of player names.
+
+	NameTagMatrix		m_nameTags;					/// Name tag visibility.
+
+	bool				m_writeCombining = false;	/// Whether setters are write-combined.
+	RawPoolType			m_pendingWritePlayers;		/// Players with pending writes.
 
 public:
 	const std::size_t	maxPlayers;
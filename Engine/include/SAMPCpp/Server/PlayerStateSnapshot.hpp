@@ -0,0 +1,95 @@
+// File description:
+// Implements per-frame snapshot of player state read from the client.
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+#include <SAMPCpp/Server/Weapon.hpp>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Player state reported by the client, read with a single batched pass of natives.
+/// </summary>
+/// <remarks>
+/// <para>The server marks snapshot dirty when client sends an update (OnPlayerUpdate)
+///	and re-reads dirty snapshots once per frame, in FramePhase::Input.</para>
+/// <para>Each field remembers the frame it was read in. Setters that change the state server-side
+///	(f.e. <c>Player::setVelocity</c>) invalidate the matching field until the next read.</para>
+/// </remarks>
+struct PlayerStateSnapshot
+{
+	using FrameNumber = std::uint64_t;
+
+	/// <summary>
+	/// Single value of the snapshot.
+	/// </summary>
+	template <typename T>
+	struct Field
+	{
+		T				value{};
+		FrameNumber		frame = 0;		// Frame in which value was read. Zero means invalid.
+
+		/// <summary>
+		/// Determines whether value was read and not invalidated since then.
+		/// </summary>
+		bool isValid() const {
+			return frame != 0;
+		}
+
+		/// <summary>
+		/// Returns number of frames since value was read.
+		/// </summary>
+		/// <param name="currentFrame_">Current frame number.</param>
+		FrameNumber getAge(FrameNumber currentFrame_) const {
+			return currentFrame_ - frame;
+		}
+
+		/// <summary>
+		/// Marks value as invalid.
+		/// </summary>
+		void invalidate() {
+			frame = 0;
+		}
+	};
+
+	/// <summary>
+	/// Keys pressed by the player.
+	/// </summary>
+	struct KeyState
+	{
+		Int32	keys		= 0;
+		Int32	upDown		= 0;
+		Int32	leftRight	= 0;
+	};
+
+	/// <summary>
+	/// Reads every field of the snapshot.
+	/// </summary>
+	/// <param name="playerIndex_">Index of the player.</param>
+	/// <param name="frame_">Current frame number.</param>
+	void capture(Int32 playerIndex_, FrameNumber frame_);
+
+	/// <summary>
+	/// Invalidates every field.
+	/// </summary>
+	void invalidate();
+
+	Field<math::Vector3f>	location;
+	Field<math::Vector3f>	velocity;
+	Field<float>			facingAngle;
+	Field<Int32>			world;			// Virtual world.
+	Field<Int32>			interior;
+	Field<float>			health;			// Health reported by the client.
+	Field<float>			armour;			// Armour reported by the client.
+	Field<Weapon::Type>		weapon;			// Weapon in hand.
+	Field<Int32>			specialAction;
+	Field<KeyState>			keys;
+
+	bool					dirty = true;	// Client sent an update since last capture.
+};
+
+}
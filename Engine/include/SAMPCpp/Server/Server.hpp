@@ -13,6 +13,7 @@
 #include <SAMPCpp/Server/Weapon.hpp>
 #include <SAMPCpp/Server/Keyboard.hpp>
 #include <SAMPCpp/Server/Dialog.hpp>
+#include <SAMPCpp/Server/FramePipeline.hpp>
 
 #include <SAMPCpp/World/MapObject.hpp>
 #include <SAMPCpp/World/Vehicle.hpp>
@@ -23,6 +24,7 @@
 #include <SAMPCpp/Core/Events.hpp>
 #include <SAMPCpp/Core/Clock.hpp>
 #include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
+#include <SAMPCpp/Core/MainThreadQueue.hpp>
 
 namespace samp_cpp
 {
@@ -141,6 +143,13 @@ public:
 	bool sampEvent_OnPlayerSelectPlayerObject(Int32 playerIndex_, Int32 objectHandle_, Int32 modelIndex_, math::Vector3f location_);
 	bool sampEvent_OnPlayerWeaponShot(Int32 playerIndex_, Weapon::Type weapon_, Weapon::HitResult hitResult_);
 
+	// Work posted from other threads. Drained once per frame in FramePhase::Input.
+	MainThreadQueue														mainThread;
+
+	// Server frame pipeline. Every frame runs phases: Input, Simulation, Streaming and Output.
+	FramePipeline														pipeline;
+
+	// Emitted every frame in FramePhase::Simulation (before handlers registered directly to the pipeline).
 	EventDispatcher<double, IUpdatable::TimePoint>						onServerUpdate;
 	EventDispatcher<>													onGameModeInit;
 	EventDispatcher<>													onGameModeExit;
@@ -148,6 +157,8 @@ public:
 	EventDispatcher<Player &>											onPlayerConnect;
 	EventDispatcher<Player &, Player::DisconnectReason>					onPlayerDisconnect;
 	EventDispatcher<Player &>											onPlayerUpdate;
+	// Same as onPlayerUpdate, but delivered at most once per player per frame (FramePhase::Input).
+	DeferredEventDispatcher<Player &>									onPlayerUpdateDeferred;
 	EventDispatcher<Player &>											onPlayerSpawn;
 	EventDispatcher<Player &, Int32>									onPlayerRequestClass;
 	EventDispatcher<Player &, Player *, Weapon::Type>					onPlayerDeath;
@@ -0,0 +1,235 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/World/Checkpoint.hpp>
+#include <SAMPCpp/World/RaceCheckpoint.hpp>
+#include <SAMPCpp/Core/Container/SpatialHashGrid.hpp>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Set of checkpoints owned by a single player.
+/// </summary>
+/// <remarks>
+/// <para>Works in one of two modes:</para>
+/// <para>- nearest mode (default): the streamer shows checkpoint nearest to the player, found using a spatial index of the set,</para>
+/// <para>- route mode: checkpoints are visited in order they were added, the streamer always shows the current one and
+///	the set advances automatically when player enters it.</para>
+/// <para>Next checkpoint of every route entry is precomputed, so advancing (and linking race checkpoints) is constant time.</para>
+/// </remarks>
+/// <example>
+/// <code>
+/// auto& route = player.raceCheckpoints;
+/// for (auto const& location : track)
+///		route.add(RaceCheckpoint{ location, {}, RaceCheckpoint::Land, 8.f });
+/// route.linkRoute();
+/// route.setRouteMode(true);
+/// </code>
+/// </example>
+template <typename TCheckpoint>
+class CheckpointSet
+{
+public:
+	constexpr static std::size_t NoCheckpoint = std::numeric_limits<std::size_t>::max();
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="CheckpointSet"/> class.
+	/// </summary>
+	/// <param name="cellSize_">Cell size of the spatial index.</param>
+	explicit CheckpointSet(float cellSize_ = 100.f)
+		: m_index{ cellSize_ }
+	{
+	}
+
+	/// <summary>
+	/// Adds the checkpoint at the end of the route.
+	/// </summary>
+	/// <param name="checkpoint_">The checkpoint.</param>
+	/// <returns>Index of the checkpoint.</returns>
+	std::size_t add(TCheckpoint checkpoint_)
+	{
+		const_a index = m_checkpoints.size();
+		m_index.insert(checkpoint_.getLocation(), index);
+		m_checkpoints.push_back(std::move(checkpoint_));
+
+		// Previous last checkpoint now leads to this one.
+		if (index > 0)
+			m_next[index - 1] = index;
+		m_next.push_back(NoCheckpoint);
+		return index;
+	}
+
+	/// <summary>
+	/// Removes every checkpoint and resets the route.
+	/// </summary>
+	void clear()
+	{
+		m_checkpoints.clear();
+		m_next.clear();
+		m_index.clear();
+		m_current = 0;
+	}
+
+	/// <summary>
+	/// Returns checkpoint with specified index.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	TCheckpoint const& get(std::size_t index_) const {
+		return m_checkpoints[index_];
+	}
+
+	/// <summary>
+	/// Returns number of checkpoints.
+	/// </summary>
+	std::size_t size() const {
+		return m_checkpoints.size();
+	}
+
+	/// <summary>
+	/// Determines whether set is empty.
+	/// </summary>
+	bool isEmpty() const {
+		return m_checkpoints.empty();
+	}
+
+	/// <summary>
+	/// Returns index of the checkpoint that follows specified one on the route.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	/// <returns>Index of the next checkpoint or <see cref="NoCheckpoint"/> if specified one is the last.</returns>
+	std::size_t getNextIndex(std::size_t index_) const {
+		return m_next[index_];
+	}
+
+	/// <summary>
+	/// Points every race checkpoint at the next one and makes the last one a finish.
+	/// </summary>
+	/// <remarks>
+	/// <para>Available only for race checkpoints.</para>
+	/// </remarks>
+	void linkRoute()
+	{
+		static_assert(std::is_base_of_v<RaceCheckpoint, TCheckpoint>, "Only race checkpoints can be linked.");
+
+		for (std::size_t i = 0; i < m_checkpoints.size(); ++i)
+		{
+			auto& checkpoint = m_checkpoints[i];
+			if (m_next[i] != NoCheckpoint)
+				checkpoint.setLookAt(m_checkpoints[m_next[i]].getLocation());
+			else if (checkpoint.getType() == RaceCheckpoint::Land)
+				checkpoint.setType(RaceCheckpoint::LandFinish);
+			else if (checkpoint.getType() == RaceCheckpoint::Air)
+				checkpoint.setType(RaceCheckpoint::AirFinish);
+		}
+	}
+
+	/// <summary>
+	/// Enables or disables route mode.
+	/// </summary>
+	/// <param name="routeMode_">if set to <c>true</c> checkpoints are visited in order.</param>
+	void setRouteMode(bool routeMode_) {
+		m_routeMode = routeMode_;
+	}
+
+	/// <summary>
+	/// Determines whether set works in route mode.
+	/// </summary>
+	bool isRouteMode() const {
+		return m_routeMode;
+	}
+
+	/// <summary>
+	/// Sets current route checkpoint.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	void setCurrentIndex(std::size_t index_) {
+		m_current = index_;
+	}
+
+	/// <summary>
+	/// Returns index of the current route checkpoint.
+	/// </summary>
+	/// <returns>The index; equal to <see cref="size"/> once the route is finished.</returns>
+	std::size_t getCurrentIndex() const {
+		return m_current;
+	}
+
+	/// <summary>
+	/// Determines whether every route checkpoint was visited.
+	/// </summary>
+	bool isFinished() const {
+		return m_current >= m_checkpoints.size();
+	}
+
+	/// <summary>
+	/// Moves to the next route checkpoint.
+	/// </summary>
+	/// <returns>
+	///		<c>true</c> if there is next checkpoint; <c>false</c> if route is finished.
+	/// </returns>
+	bool advance()
+	{
+		if (this->isFinished())
+			return false;
+
+		const_a next = m_next[m_current];
+		m_current = (next != NoCheckpoint ? next : m_checkpoints.size());
+		return !this->isFinished();
+	}
+
+	/// <summary>
+	/// Finds checkpoint nearest to specified location.
+	/// </summary>
+	/// <param name="location_">The location.</param>
+	/// <param name="maxDistance_">Maximal distance from the location.</param>
+	/// <param name="world_">World of the player.</param>
+	/// <param name="interior_">Interior of the player.</param>
+	/// <returns>Index of the checkpoint or <see cref="NoCheckpoint"/> if none is close enough.</returns>
+	std::size_t findNearest(math::Vector3f const & location_, float maxDistance_, Int32 world_, Int32 interior_) const
+	{
+		const_a nearest = m_index.findNearest(location_, 1, maxDistance_,
+				[&](typename IndexType::Entry const & entry_) {
+					return m_checkpoints[entry_.value].shouldBeVisibleIn(world_, interior_);
+				}
+			);
+		return nearest.empty() ? NoCheckpoint : nearest.front()->value;
+	}
+
+	/// <summary>
+	/// Selects checkpoint that should be shown to the player.
+	/// </summary>
+	/// <param name="location_">Location of the player.</param>
+	/// <param name="maxDistance_">Maximal distance from the player (ignored in route mode).</param>
+	/// <param name="world_">World of the player.</param>
+	/// <param name="interior_">Interior of the player.</param>
+	/// <returns>Pointer to the checkpoint or <c>nullptr</c> if none should be shown.</returns>
+	TCheckpoint const* select(math::Vector3f const & location_, float maxDistance_, Int32 world_, Int32 interior_) const
+	{
+		if (m_routeMode)
+		{
+			if (this->isFinished() || !m_checkpoints[m_current].shouldBeVisibleIn(world_, interior_))
+				return nullptr;
+			return &m_checkpoints[m_current];
+		}
+
+		const_a index = this->findNearest(location_, maxDistance_, world_, interior_);
+		return index != NoCheckpoint ? &m_checkpoints[index] : nullptr;
+	}
+
+private:
+	using IndexType = SpatialHashGrid<std::size_t>;
+
+	std::vector<TCheckpoint>	m_checkpoints;
+	std::vector<std::size_t>	m_next;
+	IndexType					m_index;
+	std::size_t					m_current	= 0;
+	bool						m_routeMode	= false;
+};
+
+using PlayerCheckpointSet		= CheckpointSet<Checkpoint>;
+using PlayerRaceCheckpointSet	= CheckpointSet<RaceCheckpoint>;
+
+}
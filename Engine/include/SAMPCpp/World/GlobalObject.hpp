@@ -42,6 +42,11 @@ public:
 	/// <returns>Placement tracker</returns>
 	IGlobalObjectPlacementTracker* getPlacementTracker() const;
 
+	/// <summary>
+	/// Sends the placement update to the tracker.
+	/// </summary>
+	void sendPlacementUpdate();
+
 	/// <summary>
 	/// Spawns this object in world.
 	/// </summary>
@@ -70,16 +75,35 @@ public:
 	/// <param name="rotationAxes_">The rotation axes.</param>
 	virtual void setRotation(math::Vector3f const & rotationAxes_) override;
 
+	/// <summary>
+	/// Moves the object to specified location with specified speed.
+	/// </summary>
+	/// <param name="targetLocation_">The target location.</param>
+	/// <param name="speed_">The speed (units per second).</param>
+	/// <param name="targetRotation_">The target rotation. Empty to keep current rotation.</param>
+	void moveTo(math::Vector3f const & targetLocation_, float const speed_, std::optional<math::Vector3f> const & targetRotation_ = std::nullopt);
+
+	/// <summary>
+	/// Stops the object motion.
+	/// </summary>
+	void stopMoving();
+
 	/// <summary>
 	/// Returns the object location.
 	/// </summary>
 	/// <returns>The object location.</returns>
+	/// <remarks>
+	/// <para>Location is tracked on the server side (interpolated while object is in motion), no native is called.</para>
+	/// </remarks>
 	virtual math::Vector3f getLocation() const override;
 
 	/// <summary>
 	/// Returns the object rotation.
 	/// </summary>
 	/// <returns>The object rotation.</returns>
+	/// <remarks>
+	/// <para>Rotation is tracked on the server side (interpolated while object is in motion), no native is called.</para>
+	/// </remarks>
 	virtual math::Vector3f getRotation() const override;
 	
 	/// <summary>
@@ -113,11 +137,10 @@ public:
 	}
 private:
 	
-	// Tracking:	
 	/// <summary>
-	/// Sends the placement update to the tracker.
+	/// Starts the native motion from current location towards the motion target.
 	/// </summary>
-	void sendPlacementUpdate();
+	void applyMotion();
 
 	/// <summary>
 	/// Applies the text material.
@@ -6,12 +6,15 @@
 #include <SAMPCpp/World/Vehicle.hpp>
 #include <SAMPCpp/World/Scene.hpp>
 #include <SAMPCpp/World/RemovedBuilding.hpp>
+#include <SAMPCpp/World/RemovedBuildingSet.hpp>
 #include <SAMPCpp/World/GangZone.hpp>
 #include <SAMPCpp/World/Checkpoint.hpp>
 #include <SAMPCpp/World/RaceCheckpoint.hpp>
+#include <SAMPCpp/Server/Player.hpp>
 
 #include <SAMPCpp/Core/Pointers.hpp>
 #include <SAMPCpp/Core/Events.hpp>
+#include <SAMPCpp/Core/Container/DenseSlotMap.hpp>
 
 
 namespace samp_cpp
@@ -28,7 +31,7 @@ public:
 	template <typename TType>
 	using ActorPtrType			= SharedPtr<TType>;
 	template <typename TType>
-	using ActorContainerType	= std::vector< ActorPtrType<TType> >;
+	using ActorContainerType	= DenseSlotMap< TType, ActorPtrType<TType> >;
 	
 	/// <summary>
 	/// Initializes a new instance of the <see cref="MapClass"/> class.
@@ -117,6 +120,15 @@ public:
 	/// </returns>
 	bool remove(StaticVehicle & vehicle_);
 
+	/// <summary>
+	/// Removes the specified scene.
+	/// </summary>
+	/// <param name="scene_">The scene.</param>
+	/// <returns>
+	///		<c>true</c> if scene existed and was removed; otherwise, <c>false</c>.
+	/// </returns>
+	bool remove(Scene & scene_);
+
 	/// <summary>
 	/// Removes the specified gang zone.
 	/// </summary>
@@ -149,14 +161,52 @@ public:
 	/// </summary>
 	/// <param name="handle_">The handle.</param>
 	/// <returns>Pointer to found vehicle or nullptr if vehicle with this handle does not exist.</returns>
+	/// <remarks>
+	/// <para>Single array access, vehicles register their handles when they spawn.</para>
+	/// </remarks>
 	Vehicle* findVehicleByHandle(Int32 const vehicleHandle_);
 		
 	/// <summary>
 	/// Removes specified building (an original map object).
 	/// </summary>
 	/// <param name="removedBuilding_">The removed building.</param>
+	/// <remarks>
+	/// <para>Duplicates and removals covered by already removed buildings are ignored.
+	///	Removal is queued for every connected player, see <see cref="applyPendingBuildingRemovals"/>.</para>
+	/// </remarks>
 	void removeBuilding(RemovedBuilding const & removedBuilding_);
 
+	/// <summary>
+	/// Applies queued building removals, up to the per-tick limit for every player.
+	/// </summary>
+	/// <remarks>
+	/// <para>Removals nearest to the player are applied first. Queue is reordered when player spawns.</para>
+	/// <para>Queued removals replaced by a larger one in the meantime are skipped and do not count towards the limit.</para>
+	/// </remarks>
+	void applyPendingBuildingRemovals();
+
+	/// <summary>
+	/// Sets maximal number of building removals applied to a single player per tick.
+	/// </summary>
+	/// <param name="count_">The count.</param>
+	void setBuildingRemovalsPerTick(std::size_t count_) {
+		m_buildingRemovalsPerTick = std::max<std::size_t>(count_, 1);
+	}
+
+	/// <summary>
+	/// Returns maximal number of building removals applied to a single player per tick.
+	/// </summary>
+	std::size_t getBuildingRemovalsPerTick() const {
+		return m_buildingRemovalsPerTick;
+	}
+
+	/// <summary>
+	/// Returns every removed building.
+	/// </summary>
+	RemovedBuildingSet const& getRemovedBuildings() const {
+		return m_removedBuildings;
+	}
+
 	/// <summary>
 	/// Returns cref to vehicle pool.
 	/// </summary>
@@ -205,6 +255,19 @@ private:
 	/// <param name="player_">The player.</param>
 	void whenPlayerConnects(Player & player_);
 
+	/// <summary>
+	/// Reorders queued building removals of the player by distance to the spawn location.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	void whenPlayerSpawns(Player & player_);
+
+	/// <summary>
+	/// Drops queued building removals of the player.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	/// <param name="reason_">The disconnect reason.</param>
+	void whenPlayerDisconnects(Player & player_, Player::DisconnectReason reason_);
+
 	/// <summary>
 	/// Applies the removed building to the player.
 	/// </summary>
@@ -213,11 +276,29 @@ private:
 	void applyRemovedBuilding(Player& player_, RemovedBuilding const& building_);
 
 	/// <summary>
-	/// Removes buildings for specified player.
+	/// Queues every removed building for specified player.
 	/// </summary>
 	/// <param name="player_">The player.</param>
 	void applyRemovedBuildings(Player & player_);
 
+	/// <summary>
+	/// Registers handle of the spawned vehicle.
+	/// </summary>
+	/// <param name="vehicle_">The vehicle.</param>
+	void whenVehicleSpawns(Vehicle & vehicle_);
+
+	/// <summary>
+	/// Unregisters handle of the vehicle that is being despawned.
+	/// </summary>
+	/// <param name="vehicle_">The vehicle.</param>
+	void whenVehicleDespawns(Vehicle & vehicle_);
+
+	friend class Vehicle;
+
+	// Spawned vehicles indexed by SAMP handle. Declared before vehicle pools, because vehicles unregister themselves when destroyed.
+	std::array< Vehicle*, MAX_VEHICLES >	m_vehiclesByHandle = {};
+
+
 	ActorContainerType< Vehicle >			m_vehicles;
 	ActorContainerType< StaticVehicle >		m_staticVehicles;
 	ActorContainerType< Scene >				m_scenes;
@@ -225,7 +306,18 @@ private:
 	ActorContainerType< Checkpoint >		m_checkpoints;
 	ActorContainerType< RaceCheckpoint >	m_raceCheckpoints;
 
-	std::vector< RemovedBuilding >			m_removedBuildings;
+	/// <summary>
+	/// Building removals waiting to be sent to a single player.
+	/// </summary>
+	struct PendingBuildingRemovals
+	{
+		std::vector< RemovedBuilding >	queue;		// Nearest removal at the back.
+		bool							sorted = false;
+	};
+
+	RemovedBuildingSet								m_removedBuildings;
+	std::array< PendingBuildingRemovals, MAX_PLAYERS >	m_pendingRemovals;
+	std::size_t										m_buildingRemovalsPerTick = 64;
 };
 
 }
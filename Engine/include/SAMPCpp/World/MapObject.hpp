@@ -10,6 +10,7 @@
 // Other headers:
 #include <SAMPCpp/Core/Pointers.hpp>
 #include <SAMPCpp/Core/Color.hpp>
+#include <SAMPCpp/World/ObjectMotion.hpp>
 
 #include <SAMPCpp/Dependencies/SampGDK.hpp>
 
@@ -66,7 +67,8 @@ public:
 
 	// Types and aliases:
 	using HandleType			= Int32;
-	using MaterialsContainer	= std::vector< UniquePtr<IMaterial> >;
+	using MaterialHandle		= SharedPtr<IMaterial const>;		// Immutable material, interned in the MaterialTable.
+	using MaterialsContainer	= std::vector< MaterialHandle >;
 
 	constexpr static Int32 InvalidHandle = INVALID_OBJECT_ID;
 
@@ -86,6 +88,7 @@ public:
 
 	// Some settings:
 	constexpr static float cxDefaultDrawDistance = 700.f;
+	constexpr static float cxKeepMotionRotation = -1000.f;	// Passed to MoveObject as rotation, keeps current rotation.
 
 	/// <summary>
 	/// A class containing texture material settings.
@@ -178,6 +181,13 @@ public:
 	/// <param name="materialIndex_">Index of the material.</param>
 	/// <param name="textureMaterial_">The texture material.</param>
 	void setMaterial(std::size_t const materialIndex_, Texture const & textureMaterial_);
+
+	/// <summary>
+	/// Sets the object material (already interned).
+	/// </summary>
+	/// <param name="materialIndex_">Index of the material.</param>
+	/// <param name="material_">The material handle, obtained from the MaterialTable.</param>
+	void setMaterial(std::size_t const materialIndex_, MaterialHandle material_);
 	
 	/// <summary>
 	/// Sets the object rotation.
@@ -229,6 +239,14 @@ public:
 	///   <c>true</c> if object is in motion; otherwise, <c>false</c>.
 	/// </returns>
 	bool isInMotion() const;
+
+	/// <summary>
+	/// Returns the motion the object was last set in (may be already finished).
+	/// </summary>
+	/// <returns>The motion. Empty if object was not moved or motion was stopped.</returns>
+	std::optional<ObjectMotion> const& getMotion() const {
+		return m_motion;
+	}
 	
 	/// <summary>
 	/// Returns object type.
@@ -255,11 +273,26 @@ protected:
 	/// <param name="player_">The player.</param>
 	virtual void applyTexture(std::size_t const materialIndex_, Texture const & textureMaterial_, Player const * player_ = nullptr) = 0;
 
-	Int32				m_modelIndex;
-	math::Vector3f		m_rotation;
-	float				m_drawDistance;
-	bool				m_inMotion;
-	MaterialsContainer	m_materials;
+	/// <summary>
+	/// Stores current transform of the motion (if any) as the object transform and forgets the motion.
+	/// </summary>
+	void settleMotion();
+
+	/// <summary>
+	/// Returns the object location, taking the motion into account. Does not call any natives.
+	/// </summary>
+	math::Vector3f getTrackedLocation() const;
+
+	/// <summary>
+	/// Returns the object rotation, taking the motion into account. Does not call any natives.
+	/// </summary>
+	math::Vector3f getTrackedRotation() const;
+
+	Int32						m_modelIndex;
+	math::Vector3f				m_rotation;
+	float						m_drawDistance;
+	std::optional<ObjectMotion>	m_motion;		// Last started motion, used to calculate in-flight transform.
+	MaterialsContainer			m_materials;
 };
 
 }
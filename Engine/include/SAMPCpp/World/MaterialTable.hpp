@@ -0,0 +1,68 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/World/MapObject.hpp>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Global table of interned (deduplicated) object materials.
+/// </summary>
+/// <remarks>
+/// <para>Large maps repeat the same few hundred materials across thousands of objects.
+///	Every object stores only a shared handle to the immutable material, so equal materials are stored once.</para>
+/// <para>Interning is thread safe, so scenes can be loaded outside of the main thread.</para>
+/// </remarks>
+class MaterialTable
+{
+public:
+	using MaterialHandle = IMapObject::MaterialHandle;
+
+	/// <summary>
+	/// Returns the table used by every <see cref="IMapObject"/>.
+	/// </summary>
+	static MaterialTable& instance();
+
+	/// <summary>
+	/// Returns handle to the material equal to specified one, adds the material if not present yet.
+	/// </summary>
+	/// <param name="textMaterial_">The text material.</param>
+	/// <returns>Shared handle to the interned material.</returns>
+	MaterialHandle intern(IMapObject::Text const & textMaterial_);
+
+	/// <summary>
+	/// Returns handle to the material equal to specified one, adds the material if not present yet.
+	/// </summary>
+	/// <param name="textureMaterial_">The texture material.</param>
+	/// <returns>Shared handle to the interned material.</returns>
+	MaterialHandle intern(IMapObject::Texture const & textureMaterial_);
+
+	/// <summary>
+	/// Removes materials that are not used by any object.
+	/// </summary>
+	/// <returns>Number of removed materials.</returns>
+	std::size_t purgeUnused();
+
+	/// <summary>
+	/// Returns number of interned materials.
+	/// </summary>
+	std::size_t size() const;
+
+private:
+	struct TextHash		{ std::size_t operator()(IMapObject::Text const & material_) const; };
+	struct TextEqual	{ bool operator()(IMapObject::Text const & lhs_, IMapObject::Text const & rhs_) const; };
+	struct TextureHash	{ std::size_t operator()(IMapObject::Texture const & material_) const; };
+	struct TextureEqual	{ bool operator()(IMapObject::Texture const & lhs_, IMapObject::Texture const & rhs_) const; };
+
+	mutable std::mutex																m_mutex;
+	std::unordered_map<IMapObject::Text, MaterialHandle, TextHash, TextEqual>		m_texts;
+	std::unordered_map<IMapObject::Texture, MaterialHandle, TextureHash, TextureEqual>	m_textures;
+};
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+#include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Describes object movement started with MoveObject (or MovePlayerObject).
+/// </summary>
+/// <remarks>
+/// <para>The game moves object along a straight line with constant speed and rotates it proportionally
+///	to the progress, so the in-flight transform can be calculated from the start, the target and the elapsed time.
+///	No native call is needed to read it.</para>
+/// </remarks>
+struct ObjectMotion
+{
+	using TimePoint	= IUpdatable::TimePoint;
+	using Duration	= IUpdatable::Duration;
+
+	math::Vector3f					startLocation;
+	math::Vector3f					targetLocation;
+	math::Vector3f					startRotation;
+	std::optional<math::Vector3f>	targetRotation;		// Empty if rotation does not change.
+	float							speed = 0.f;		// Units per second.
+	TimePoint						startTime;
+	Duration						duration = Duration::zero();
+
+	/// <summary>
+	/// Creates the motion.
+	/// </summary>
+	/// <param name="startLocation_">Location the object starts moving from.</param>
+	/// <param name="startRotation_">Rotation the object starts moving with.</param>
+	/// <param name="targetLocation_">Target location.</param>
+	/// <param name="targetRotation_">Target rotation (empty to keep current one).</param>
+	/// <param name="speed_">Speed in units per second.</param>
+	/// <param name="startTime_">The point of time in which motion starts.</param>
+	/// <returns>The motion.</returns>
+	static ObjectMotion begin(math::Vector3f const & startLocation_, math::Vector3f const & startRotation_,
+		math::Vector3f const & targetLocation_, std::optional<math::Vector3f> const & targetRotation_,
+		float speed_, TimePoint startTime_)
+	{
+		ObjectMotion motion;
+		motion.startLocation	= startLocation_;
+		motion.targetLocation	= targetLocation_;
+		motion.startRotation	= startRotation_;
+		motion.targetRotation	= targetRotation_;
+		motion.speed			= speed_;
+		motion.startTime		= startTime_;
+
+		const_a distance = std::sqrt(startLocation_.distanceSquared(targetLocation_));
+		if (speed_ > 0.f)
+			motion.duration = chrono::duration_cast<Duration>( seconds_f{ distance / speed_ } );
+		return motion;
+	}
+
+	/// <summary>
+	/// Returns progress of the motion at specified time, in range [0; 1].
+	/// </summary>
+	/// <param name="time_">The time.</param>
+	float progressAt(TimePoint time_) const
+	{
+		if (duration <= Duration::zero() || time_ >= startTime + duration)
+			return 1.f;
+		if (time_ <= startTime)
+			return 0.f;
+		return seconds_f{ time_ - startTime }.count() / seconds_f{ duration }.count();
+	}
+
+	/// <summary>
+	/// Determines whether motion is finished at specified time.
+	/// </summary>
+	/// <param name="time_">The time.</param>
+	bool isFinishedAt(TimePoint time_) const {
+		return this->progressAt(time_) >= 1.f;
+	}
+
+	/// <summary>
+	/// Returns location of the object at specified time.
+	/// </summary>
+	/// <param name="time_">The time.</param>
+	math::Vector3f locationAt(TimePoint time_) const {
+		return lerp(startLocation, targetLocation, this->progressAt(time_));
+	}
+
+	/// <summary>
+	/// Returns rotation of the object at specified time.
+	/// </summary>
+	/// <param name="time_">The time.</param>
+	math::Vector3f rotationAt(TimePoint time_) const {
+		return targetRotation ? lerp(startRotation, *targetRotation, this->progressAt(time_)) : startRotation;
+	}
+
+private:
+	/// <summary>
+	/// Linearly interpolates between two vectors.
+	/// </summary>
+	static math::Vector3f lerp(math::Vector3f const & from_, math::Vector3f const & to_, float t_)
+	{
+		return {
+				from_.x + (to_.x - from_.x) * t_,
+				from_.y + (to_.y - from_.y) * t_,
+				from_.z + (to_.z - from_.z) * t_
+			};
+	}
+};
+
+}
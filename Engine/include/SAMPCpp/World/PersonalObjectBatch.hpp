@@ -0,0 +1,115 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/World/MapObject.hpp>
+
+#include <variant>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Describes many personal objects (with materials) to be constructed at once.
+/// </summary>
+/// <remarks>
+/// <para>Everything is validated when added, so <see cref="Player::constructPersonalObjects"/>
+///	only allocates once and hands every object to the streamer in a single bulk insertion.</para>
+/// </remarks>
+/// <example>
+/// <code>
+/// PersonalObjectBatch batch;
+/// batch.reserve(track.size());
+/// for (auto const& piece : track)
+///		batch.add(piece.model, piece.location, piece.rotation);
+/// player.constructPersonalObjects(batch);
+/// </code>
+/// </example>
+class PersonalObjectBatch
+{
+public:
+	using Material = std::variant<IMapObject::Text, IMapObject::Texture>;
+
+	/// <summary>
+	/// Description of a single object.
+	/// </summary>
+	struct Entry
+	{
+		Int32			modelIndex;
+		math::Vector3f	location;
+		math::Vector3f	rotation;
+		float			drawDistance;
+	};
+
+	/// <summary>
+	/// Material of a single object.
+	/// </summary>
+	struct MaterialEntry
+	{
+		std::size_t		objectIndex;
+		std::size_t		materialIndex;
+		Material		material;
+	};
+
+	/// <summary>
+	/// Reserves space for specified number of objects.
+	/// </summary>
+	/// <param name="objectCount_">The object count.</param>
+	void reserve(std::size_t objectCount_) {
+		m_entries.reserve(objectCount_);
+	}
+
+	/// <summary>
+	/// Adds the object.
+	/// </summary>
+	/// <param name="modelIndex_">Index of the model.</param>
+	/// <param name="location_">The location.</param>
+	/// <param name="rotation_">The rotation.</param>
+	/// <param name="drawDistance_">The draw distance.</param>
+	/// <returns>Index of the object inside the batch.</returns>
+	std::size_t add(Int32 modelIndex_, math::Vector3f const & location_, math::Vector3f const & rotation_ = {},
+		float drawDistance_ = IMapObject::cxDefaultDrawDistance);
+
+	/// <summary>
+	/// Sets material of the object.
+	/// </summary>
+	/// <param name="objectIndex_">Index of the object inside the batch.</param>
+	/// <param name="materialIndex_">Index of the material.</param>
+	/// <param name="material_">The material.</param>
+	/// <returns>
+	///		<c>true</c> if material is valid; otherwise, <c>false</c>.
+	/// </returns>
+	bool setMaterial(std::size_t objectIndex_, std::size_t materialIndex_, Material material_);
+
+	/// <summary>
+	/// Returns every object.
+	/// </summary>
+	std::vector<Entry> const& getEntries() const {
+		return m_entries;
+	}
+
+	/// <summary>
+	/// Returns every material, sorted by object index.
+	/// </summary>
+	std::vector<MaterialEntry> const& getMaterials() const;
+
+	/// <summary>
+	/// Returns number of objects.
+	/// </summary>
+	std::size_t size() const {
+		return m_entries.size();
+	}
+
+	/// <summary>
+	/// Removes every object.
+	/// </summary>
+	void clear();
+
+private:
+	std::vector<Entry>					m_entries;
+	mutable std::vector<MaterialEntry>	m_materials;
+	mutable bool						m_materialsSorted = true;
+};
+
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/Core/Placement.hpp>
+#include <SAMPCpp/Core/TypesAndDefinitions.hpp>
+
+#include <SAMPCpp/Dependencies/QuickMaffs.hpp>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Area of the world (box, sphere or 2D polygon extruded between two heights) limited to world and interior.
+/// </summary>
+/// <remarks>
+/// <para>World and interior are compared the same way as in <see cref="ActorPlacement"/>,
+///	<see cref="Region::Any"/> matches every world (interior).</para>
+/// </remarks>
+class Region
+{
+public:
+	using Id = Uint64;
+
+	constexpr static Int32	Any			= -1;
+	constexpr static Id		InvalidId	= 0;
+
+	enum class Shape
+	{
+		Box,
+		Sphere,
+		Polygon
+	};
+
+	/// <summary>
+	/// Creates axis-aligned box region.
+	/// </summary>
+	/// <param name="min_">Minimal corner.</param>
+	/// <param name="max_">Maximal corner.</param>
+	/// <param name="world_">The world.</param>
+	/// <param name="interior_">The interior.</param>
+	static Region box(math::Vector3f const & min_, math::Vector3f const & max_, Int32 world_ = Any, Int32 interior_ = Any);
+
+	/// <summary>
+	/// Creates sphere region.
+	/// </summary>
+	/// <param name="center_">The center.</param>
+	/// <param name="radius_">The radius.</param>
+	/// <param name="world_">The world.</param>
+	/// <param name="interior_">The interior.</param>
+	static Region sphere(math::Vector3f const & center_, float radius_, Int32 world_ = Any, Int32 interior_ = Any);
+
+	/// <summary>
+	/// Creates polygon region.
+	/// </summary>
+	/// <param name="points_">Points of the polygon (XY plane).</param>
+	/// <param name="minZ_">Minimal height.</param>
+	/// <param name="maxZ_">Maximal height.</param>
+	/// <param name="world_">The world.</param>
+	/// <param name="interior_">The interior.</param>
+	static Region polygon(std::vector<math::Vector2f> points_, float minZ_, float maxZ_, Int32 world_ = Any, Int32 interior_ = Any);
+
+	/// <summary>
+	/// Determines whether the region contains specified placement.
+	/// </summary>
+	/// <param name="placement_">The placement.</param>
+	/// <returns>
+	///		<c>true</c> if region contains the placement; otherwise, <c>false</c>.
+	/// </returns>
+	bool contains(ActorPlacement const & placement_) const;
+
+	/// <summary>
+	/// Determines whether the region contains specified location (ignores world and interior).
+	/// </summary>
+	/// <param name="location_">The location.</param>
+	/// <returns>
+	///		<c>true</c> if region contains the location; otherwise, <c>false</c>.
+	/// </returns>
+	bool contains(math::Vector3f const & location_) const;
+
+	/// <summary>
+	/// Returns id of the region. Assigned when region is added to <see cref="RegionTriggers"/>.
+	/// </summary>
+	Id getId() const {
+		return m_id;
+	}
+
+	/// <summary>
+	/// Returns the shape.
+	/// </summary>
+	Shape getShape() const {
+		return m_shape;
+	}
+
+	/// <summary>
+	/// Returns minimal corner of the bounding box.
+	/// </summary>
+	math::Vector3f const& getBoundsMin() const {
+		return m_min;
+	}
+
+	/// <summary>
+	/// Returns maximal corner of the bounding box.
+	/// </summary>
+	math::Vector3f const& getBoundsMax() const {
+		return m_max;
+	}
+
+	/// <summary>
+	/// Returns the world.
+	/// </summary>
+	Int32 getWorld() const {
+		return m_world;
+	}
+
+	/// <summary>
+	/// Returns the interior.
+	/// </summary>
+	Int32 getInterior() const {
+		return m_interior;
+	}
+
+	friend class RegionTriggers;
+private:
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Region"/> class.
+	/// </summary>
+	Region(Shape shape_, Int32 world_, Int32 interior_);
+
+	Id							m_id = InvalidId;
+	Shape						m_shape;
+	math::Vector3f				m_min;			// Bounding box.
+	math::Vector3f				m_max;
+	math::Vector3f				m_center;		// Sphere only.
+	float						m_radiusSq = 0;	// Sphere only.
+	std::vector<math::Vector2f>	m_points;		// Polygon only.
+	Int32						m_world;
+	Int32						m_interior;
+};
+
+}
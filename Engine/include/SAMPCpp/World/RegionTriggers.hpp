@@ -0,0 +1,132 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/World/Region.hpp>
+#include <SAMPCpp/Core/Events.hpp>
+#include <SAMPCpp/Core/Container/SpatialHashGrid.hpp>
+
+#include <unordered_map>
+
+namespace samp_cpp
+{
+
+class Player;
+class PlayerPool;
+
+/// <summary>
+/// Detects players entering and leaving regions.
+/// </summary>
+/// <remarks>
+/// <para>Regions are stored in a uniform grid (XY plane), each player is tested only against regions
+///	overlapping its cell. Evaluated once per tick (FramePhase::Input) with player locations cached by
+///	<see cref="PlayerPool::refreshSpatialIndex"/>.</para>
+/// <para>Regions spanning more than <see cref="MaxRegionCells"/> cells (f.e. whole-map regions) are not stored
+///	in the grid, but in a separate list that is checked for every player.</para>
+/// <para>Removing a region does not emit leave events.</para>
+/// </remarks>
+class RegionTriggers
+{
+public:
+	constexpr static float CellSize = 100.f;
+
+	/// Regions spanning more cells are checked for every player instead of being stored in the grid.
+	constexpr static double MaxRegionCells = 64;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="RegionTriggers"/> class.
+	/// </summary>
+	RegionTriggers();
+
+	/// <summary>
+	/// Adds the region.
+	/// </summary>
+	/// <param name="region_">The region.</param>
+	/// <returns>Id of the region.</returns>
+	Region::Id add(Region region_);
+
+	/// <summary>
+	/// Removes the region.
+	/// </summary>
+	/// <param name="id_">Id of the region.</param>
+	/// <returns>
+	///		<c>true</c> if region was removed; otherwise, <c>false</c>.
+	/// </returns>
+	bool remove(Region::Id id_);
+
+	/// <summary>
+	/// Returns region with specified id.
+	/// </summary>
+	/// <param name="id_">Id of the region.</param>
+	/// <returns>The region. May be null pointer.</returns>
+	Region const* get(Region::Id id_) const;
+
+	/// <summary>
+	/// Determines whether player is inside specified region (as of last update).
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	/// <param name="id_">Id of the region.</param>
+	/// <returns>
+	///		<c>true</c> if player is inside the region; otherwise, <c>false</c>.
+	/// </returns>
+	bool isPlayerInside(Player const & player_, Region::Id id_) const;
+
+	/// <summary>
+	/// Returns regions player is inside (as of last update), sorted by id.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	std::vector<Region::Id> const& getRegionsOf(Player const & player_) const;
+
+	/// <summary>
+	/// Returns number of regions.
+	/// </summary>
+	std::size_t size() const {
+		return m_regions.size();
+	}
+
+	/// <summary>
+	/// Tests every connected player against nearby regions and emits enter and leave events.
+	/// </summary>
+	/// <param name="players_">The player pool.</param>
+	/// <remarks>
+	/// <para>Call it after <c>PlayerPool::refreshStateSnapshots</c> and <c>PlayerPool::refreshSpatialIndex</c>,
+	///	so that player placement is read from the snapshot and not from natives.</para>
+	/// </remarks>
+	void update(PlayerPool const & players_);
+
+	/// <summary>
+	/// Called when player disconnects. Does not emit leave events.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	void whenPlayerDisconnects(Player const & player_);
+
+	EventDispatcher<Player &, Region const &>	onPlayerEnterRegion;
+	EventDispatcher<Player &, Region const &>	onPlayerLeaveRegion;
+
+private:
+	/// <summary>
+	/// Calls the function with the large region list or with every cell (created if needed)
+	/// overlapping bounds of the region.
+	/// </summary>
+	template <typename TFunc>
+	void forEachCellOf(Region const & region_, TFunc && func_);
+
+	/// <summary>
+	/// Tests regions from the list against the placement and appends ones that contain it to m_inside.
+	/// </summary>
+	void collectContaining(std::vector<Region::Id> const & regions_, ActorPlacement const & placement_);
+
+	Region::Id												m_nextId;
+	std::unordered_map<Region::Id, Region>					m_regions;
+	std::unordered_map< Uint64, std::vector<Region::Id> >	m_cells;
+	std::vector<Region::Id>									m_largeRegions;		/// Regions not stored in the grid.
+	std::vector< std::vector<Region::Id> >					m_playerRegions;	/// Sorted ids, by player index.
+
+	// Buffers reused by update.
+	std::vector<Region::Id>									m_inside;
+	std::vector<Region::Id>									m_entered;
+	std::vector<Region::Id>									m_left;
+};
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include SAMPCPP_PCH
+
+
+
+#include <SAMPCpp/World/RemovedBuilding.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace samp_cpp
+{
+
+/// <summary>
+/// Set of removed buildings without duplicates and without removals covered by other ones.
+/// </summary>
+/// <remarks>
+/// <para>Removal A covers removal B when A removes B's model (or any model)
+///	and B's sphere lies entirely inside A's sphere - applying B after A has no effect.</para>
+/// </remarks>
+class RemovedBuildingSet
+{
+public:
+	/// Size of a grid cell used by <see cref="coalesce"/>.
+	constexpr static float CoalesceCellSize = 50.f;
+
+	/// Removals with larger radius are not indexed in the grid by <see cref="coalesce"/>.
+	constexpr static float CoalesceLargeRadius = 200.f;
+
+	/// <summary>
+	/// Adds the removed building.
+	/// </summary>
+	/// <param name="building_">The removed building.</param>
+	/// <returns>
+	///		<c>true</c> if building was added; <c>false</c> if it is a duplicate or is covered by already added one.
+	/// </returns>
+	/// <remarks>
+	/// <para>Added building replaces every already added one that it covers.</para>
+	/// </remarks>
+	bool add(RemovedBuilding const & building_);
+
+	/// <summary>
+	/// Determines whether the set stores exactly specified removal (it was added and not replaced since then).
+	/// </summary>
+	/// <param name="building_">The removed building.</param>
+	bool contains(RemovedBuilding const & building_) const {
+		return m_exact.find(building_) != m_exact.end();
+	}
+
+	/// <summary>
+	/// Determines whether specified removal has no effect after removals from this set.
+	/// </summary>
+	/// <param name="building_">The removed building.</param>
+	bool covers(RemovedBuilding const & building_) const;
+
+	/// <summary>
+	/// Removes every building.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns number of stored buildings.
+	/// </summary>
+	std::size_t size() const {
+		return m_exact.size();
+	}
+
+	/// <summary>
+	/// Returns every stored building.
+	/// </summary>
+	std::vector<RemovedBuilding> getAll() const;
+
+	/// <summary>
+	/// Calls the function for every stored building.
+	/// </summary>
+	/// <param name="func_">The function, called with `RemovedBuilding const&`.</param>
+	template <typename TFunc>
+	void forEach(TFunc && func_) const
+	{
+		for (auto const & [model, buildings] : m_byModel)
+		{
+			for (auto const & building : buildings)
+				func_(building);
+		}
+	}
+
+	/// <summary>
+	/// Reduces the list to removals that are not covered by any other one from the list.
+	/// </summary>
+	/// <param name="buildings_">The removed buildings.</param>
+	/// <returns>Minimal subset of removals that removes exactly the same buildings.</returns>
+	/// <remarks>
+	/// <para>Removals are never merged into bigger spheres, as it could remove buildings that were not requested.
+	///	Only removals that lie entirely inside other ones are dropped, so the result is exact.</para>
+	/// <para>Larger removals are processed first and indexed in a spatial hash grid per model,
+	///	so every removal is checked only against nearby larger ones. Removals of any model and removals
+	///	with radius above <see cref="CoalesceLargeRadius"/> are kept in a short list and checked directly,
+	///	so a whole-map removal does not make every grid search cover the whole map.</para>
+	/// </remarks>
+	static std::vector<RemovedBuilding> coalesce(std::vector<RemovedBuilding> buildings_);
+
+	/// <summary>
+	/// Determines whether the first removal covers the second one.
+	/// </summary>
+	/// <param name="covering_">The covering removal.</param>
+	/// <param name="covered_">The covered removal.</param>
+	static bool covers(RemovedBuilding const & covering_, RemovedBuilding const & covered_);
+
+private:
+	struct Hash
+	{
+		std::size_t operator()(RemovedBuilding const & building_) const;
+	};
+
+	/// <summary>
+	/// Determines whether any building from the list covers specified one.
+	/// </summary>
+	static bool anyCovers(std::vector<RemovedBuilding> const & buildings_, RemovedBuilding const & building_);
+
+	/// <summary>
+	/// Drops every building covered by specified one from the list.
+	/// </summary>
+	void dropCoveredBy(std::vector<RemovedBuilding> & buildings_, RemovedBuilding const & building_);
+
+	std::unordered_set<RemovedBuilding, Hash>						m_exact;
+	std::unordered_map< Int32, std::vector<RemovedBuilding> >		m_byModel;
+};
+
+}
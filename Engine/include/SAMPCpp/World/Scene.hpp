@@ -15,6 +15,7 @@
 
 // Core:
 #include <SAMPCpp/Core/Pointers.hpp>
+#include <SAMPCpp/Core/Container/DenseSlotMap.hpp>
 
 namespace samp_cpp
 {
@@ -32,7 +33,16 @@ public:
 	template <typename TType>
 	using ObjectPtrType = SharedPtr<TType>;
 	template <typename TType>
-	using ObjectContainerType = std::vector< ObjectPtrType<TType> >;
+	using ObjectContainerType = DenseSlotMap< TType, ObjectPtrType<TType> >;
+
+	/// <summary>
+	/// Bounding sphere of the scene objects.
+	/// </summary>
+	struct Bounds
+	{
+		math::Vector3f	center;
+		float			radius = 0.f;
+	};
 
 	/// <summary>
 	/// Initializes a new instance of the <see cref="Scene"/> class.
@@ -86,6 +96,24 @@ public:
 	/// <param name="universalObject_">The universal object.</param>
 	/// <returns>Reference to created object.</returns>
 	UniversalObject& finalizeConstruction(ObjectPtrType< UniversalObject > const& universalObject_);
+
+	/// <summary>
+	/// Removes the global object from the scene.
+	/// </summary>
+	/// <param name="globalObject_">The global object.</param>
+	/// <returns>
+	///   <c>true</c> if object was removed; otherwise <c>false</c>.
+	/// </returns>
+	bool remove(GlobalObject & globalObject_);
+
+	/// <summary>
+	/// Removes the universal object from the scene.
+	/// </summary>
+	/// <param name="universalObject_">The universal object.</param>
+	/// <returns>
+	///   <c>true</c> if object was removed; otherwise <c>false</c>.
+	/// </returns>
+	bool remove(UniversalObject & universalObject_);
 	
 	/// <summary>
 	/// Removes building from the GTA original map.
@@ -106,7 +134,7 @@ public:
 	/// <returns>
 	///   <c>true</c> if scene contains the specified object; otherwise <c>false</c>.
 	/// </returns>
-	bool contains(IMapObject & object_);
+	bool contains(IMapObject const & object_) const;
 
 	/// <summary>
 	/// Sets the origin to specified location.
@@ -126,6 +154,82 @@ public:
 	/// <param name="delta_">The delta.</param>
 	void move(math::Vector3f const delta_);
 
+	/// <summary>
+	/// Begins the transform transaction. Until <see cref="commitTransform"/> is called,
+	/// relocating the scene only moves the objects and defers every streamer update.
+	/// </summary>
+	/// <remarks>
+	/// <para>Use it to apply many transformations at once, streamer will process every object only once.</para>
+	/// </remarks>
+	void beginTransform();
+
+	/// <summary>
+	/// Ends the transform transaction, notifies the streamer about every moved object in a single pass.
+	/// </summary>
+	void commitTransform();
+
+	/// <summary>
+	/// Determines whether transform transaction is in progress.
+	/// </summary>
+	/// <returns>
+	///   <c>true</c> if transform transaction is in progress; otherwise, <c>false</c>.
+	/// </returns>
+	bool isTransforming() const {
+		return m_transforming;
+	}
+
+	/// <summary>
+	/// Sets the lazy registration flag. Does not do anything if called after scene was added to map.
+	/// </summary>
+	/// <param name="lazy_">The lazy registration flag.</param>
+	/// <remarks>
+	/// <para>Objects of a lazy scene are not registered in the streamer when the scene is added to the map.
+	///	Streamer tracks only the scene bounds and materializes the scene once any player approaches it.</para>
+	/// </remarks>
+	void setLazy(bool const lazy_);
+
+	/// <summary>
+	/// Determines whether scene uses lazy registration.
+	/// </summary>
+	/// <returns>
+	///   <c>true</c> if scene is lazy; otherwise, <c>false</c>.
+	/// </returns>
+	bool isLazy() const {
+		return m_lazy;
+	}
+
+	/// <summary>
+	/// Registers every object in the streamer. Does nothing if scene is not inside map or is already materialized.
+	/// </summary>
+	/// <remarks>
+	/// <para>Called by the streamer for lazy scenes.</para>
+	/// </remarks>
+	void materialize();
+
+	/// <summary>
+	/// Unregisters every object from the streamer.
+	/// </summary>
+	/// <remarks>
+	/// <para>Called by the streamer for lazy scenes.</para>
+	/// </remarks>
+	void dematerialize();
+
+	/// <summary>
+	/// Determines whether objects of the scene are registered in the streamer.
+	/// </summary>
+	/// <returns>
+	///   <c>true</c> if scene is materialized; otherwise, <c>false</c>.
+	/// </returns>
+	bool isMaterialized() const {
+		return m_materialized;
+	}
+
+	/// <summary>
+	/// Returns the bounding sphere of the scene objects (recalculated only after the scene changes).
+	/// </summary>
+	/// <returns>The bounds.</returns>
+	Bounds getBounds() const;
+
 	/// <summary>
 	/// Sets the automatic origin flag and recalculates origin if set to true.
 	/// </summary>
@@ -149,6 +253,9 @@ public:
 	/// <summary>
 	/// Returns cref to the objects container (containing non-owining ptrs).
 	/// </summary>
+	/// <remarks>
+	/// <para>Removing an object changes the order of the objects.</para>
+	/// </remarks>
 	/// <returns>
 	///		cref to the objects container (containing non-owining ptrs).
 	/// </returns>
@@ -189,10 +296,23 @@ private:
 	/// <param name="object_">The object.</param>
 	void applyNewObjectToOrigin(IMapObject const & object_, std::size_t newObjectsCount_);
 
+	/// <summary>
+	/// Removes the object from the origin.
+	/// </summary>
+	/// <param name="object_">The object.</param>
+	/// <param name="newObjectsCount_">Number of objects after the removal.</param>
+	void applyRemovedObjectToOrigin(IMapObject const & object_, std::size_t newObjectsCount_);
+
 	bool									m_insideMap;		// Determines whether this scene is placed inside the map.
+	bool									m_transforming;		// Determines whether transform transaction is in progress.
+	bool									m_transformDirty;	// Determines whether any object moved during the transaction.
+	bool									m_lazy;				// Determines whether objects are registered in the streamer on demand.
+	bool									m_materialized;		// Determines whether objects are registered in the streamer.
+	mutable bool							m_boundsDirty;
+	mutable Bounds							m_bounds;
 	bool									m_autoOrigin;
 	math::Vector3f							m_origin;
-	std::vector<IMapObject*>				m_objects;
+	DenseSlotMap<IMapObject, IMapObject*>	m_objects;
 	std::vector<RemovedBuilding>			m_removedBuildings;
 	ObjectContainerType< GlobalObject >		m_globalObjects;
 	ObjectContainerType< UniversalObject >	m_universalObjects;
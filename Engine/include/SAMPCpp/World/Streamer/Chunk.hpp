@@ -73,6 +73,12 @@ public:
 	/// <param name="personalObject_">The personal object.</param>
 	void intercept(UniquePtr<PersonalObjectWrapper> && personalObject_);
 
+	/// <summary>
+	/// Intercepts every specified personal object.
+	/// </summary>
+	/// <param name="personalObjects_">The personal objects.</param>
+	void intercept(ActorContainer<PersonalObjectWrapper> && personalObjects_);
+
 	/// <summary>
 	/// Intercepts the specified checkpoint.
 	/// </summary>
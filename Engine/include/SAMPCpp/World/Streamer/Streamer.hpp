@@ -10,6 +10,9 @@
 #include <SAMPCpp/Core/BasicInterfaces/Updatable.hpp>
 #include <SAMPCpp/Core/Events.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
+
 
 namespace samp_cpp::default_streamer
 {
@@ -60,6 +63,17 @@ public:
 	/// </summary>
 	/// <param name="personalObject_">The personal object.</param>
 	virtual void whenObjectJoinsMap(PersonalObject& personalObject_) override;
+
+	/// <summary>
+	/// Event reaction designed to be called when many personal objects of the same player join map at once.
+	/// </summary>
+	/// <param name="owner_">The player that owns every object.</param>
+	/// <param name="personalObjects_">The personal objects.</param>
+	/// <remarks>
+	/// <para>Wrappers are binned by chunk, so every chunk grows once. Visibility of the owner is then evaluated once,
+	///	so objects around the owner are spawned right away instead of with the next placement change.</para>
+	/// </remarks>
+	void whenObjectsJoinMap(Player & owner_, std::vector<PersonalObject*> const & personalObjects_) override;
 	
 	/// <summary>
 	/// Event reaction designed to be called when universal object joins map.
@@ -175,6 +189,51 @@ public:
 	/// <param name="currentPlacement_">The current placement.</param>
 	void whenObjectPlacementChanges(PersonalObject & personalObject_, ActorPlacement const& previousPlacement_, ActorPlacement const& currentPlacement_) override;
 
+	/// <summary>
+	/// Event reaction designed to be called after many objects were moved at once (e.g. whole scene).
+	/// </summary>
+	/// <param name="globalObjects_">The moved global objects.</param>
+	/// <param name="universalObjects_">The moved universal objects.</param>
+	/// <remarks>
+	/// <para>Objects are moved between chunks in a single pass. Visibility of global objects is then recalculated
+	///	against players close to the moved area, and each of these players has per-player objects re-evaluated once.</para>
+	/// </remarks>
+	void whenObjectsRelocated(std::vector<GlobalObject*> const& globalObjects_, std::vector<UniversalObject*> const& universalObjects_) override;
+
+	/// <summary>
+	/// Event reaction designed to be called when the global object starts moving.
+	/// </summary>
+	/// <param name="globalObject_">The global object.</param>
+	/// <remarks>
+	/// <para>Placement of a moving object is sent with every streamer update, until the motion ends.</para>
+	/// </remarks>
+	void whenObjectStartsMoving(GlobalObject & globalObject_) override;
+
+	/// <summary>
+	/// Event reaction designed to be called when the universal object starts moving.
+	/// </summary>
+	/// <param name="universalObject_">The universal object.</param>
+	/// <remarks>
+	/// <para>Placement of a moving object is sent with every streamer update, until the motion ends.</para>
+	/// </remarks>
+	void whenObjectStartsMoving(UniversalObject & universalObject_) override;
+
+	/// <summary>
+	/// Event reaction designed to be called when lazy scene joins map.
+	/// </summary>
+	/// <param name="scene_">The scene.</param>
+	/// <remarks>
+	/// <para>Only the bounds of the scene are tracked. Scene is materialized when any player approaches it
+	///	and released after nobody was around for <c>StreamerSettings.LazySceneIdleTime</c>.</para>
+	/// </remarks>
+	void whenLazySceneJoinsMap(Scene & scene_) override;
+
+	/// <summary>
+	/// Event reaction designed to be called when lazy scene leaves map.
+	/// </summary>
+	/// <param name="scene_">The scene.</param>
+	void whenLazySceneLeavesMap(Scene & scene_) override;
+
 
 	/// <summary>
 	/// Collects every chunk in specified radius from the specified location.
@@ -199,6 +258,17 @@ private:
 	/// <param name="location_">Custom location of the object, because last placement is not always the case.</param>
 	void recalculateVisibility(IGlobalActorWrapper &wrapper_, math::Vector3f location_);
 
+	/// <summary>
+	/// Materializes lazy scenes players approached and releases the idle ones.
+	/// </summary>
+	/// <param name="frameTime_">The frame time.</param>
+	void updateLazyScenes(IUpdatable::TimePoint frameTime_);
+
+	/// <summary>
+	/// Sends placement of every moving object. Forgets objects that stopped moving.
+	/// </summary>
+	void updateMovingObjects();
+
 	/// <summary>
 	/// Determines whether specified location is outside boundaries.
 	/// </summary>
@@ -284,7 +354,13 @@ private:
 	static UniversalObjectWrapper& getWrapper(UniversalObject const & universalObject_);
 
 	IUpdatable::TimePoint	m_nextUpdate,
-							m_nextCheckpointRestream;
+							m_nextCheckpointRestream,
+							m_nextLazySceneCheck;
+
+	std::unordered_map<Scene*, IUpdatable::TimePoint>	m_lazyScenes;	// Lazy scenes along with the last time any player was close to them.
+
+	std::unordered_set<GlobalObject*>		m_movingGlobalObjects;		// Objects whose placement is sent with every update.
+	std::unordered_set<UniversalObject*>	m_movingUniversalObjects;	// Objects whose placement is sent with every update.
 
 	GridType				m_worldGrid;	// Stores chunks in certain area (typically huge cube with center on {0, 0, 0}) as divisible grid. Searching through it is really fast.
 	Chunk					m_entireWorld;	// Contains every actor that does not fit outside m_worldGrid. Searching through this chunks is a lot slower since it is not divided into smaller ones.
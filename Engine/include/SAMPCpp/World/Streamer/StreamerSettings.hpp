@@ -16,6 +16,9 @@ struct StreamerSettingsType
 	math::Meters				MaxDisplacementDistance	= 10.0;				// When displacement reaches this value the change is a significant one.
 	std::chrono::milliseconds	UpdateInterval{ 60 };
 	std::chrono::milliseconds	CheckpointRestreamInterval{ 400 };
+	math::Meters				LazySceneMargin			= 100.0;			// Lazy scene is materialized when player gets this far from its visibility range.
+	std::chrono::milliseconds	LazySceneCheckInterval{ 1000 };
+	std::chrono::milliseconds	LazySceneIdleTime{ 60'000 };				// Lazy scene is released after no player was close to it for this long.
 
 	// Methods:	
 
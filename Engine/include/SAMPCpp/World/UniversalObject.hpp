@@ -6,6 +6,8 @@
 // Base class header:
 #include <SAMPCpp/World/PerPlayerObject.hpp>
 
+#include <SAMPCpp/Core/Container/PlayerHandleTable.hpp>
+
 namespace samp_cpp
 {
 
@@ -39,6 +41,31 @@ public:
 	/// </summary>
 	/// <param name="rotationAxes_">The rotation axes.</param>
 	virtual void setRotation(math::Vector3f const & rotationAxes_) override;
+
+	/// <summary>
+	/// Moves the object (for every player) to specified location with specified speed.
+	/// </summary>
+	/// <param name="targetLocation_">The target location.</param>
+	/// <param name="speed_">The speed (units per second).</param>
+	/// <param name="targetRotation_">The target rotation. Empty to keep current rotation.</param>
+	void moveTo(math::Vector3f const & targetLocation_, float const speed_, std::optional<math::Vector3f> const & targetRotation_ = std::nullopt);
+
+	/// <summary>
+	/// Stops the object motion.
+	/// </summary>
+	void stopMoving();
+
+	/// <summary>
+	/// Returns the object location (interpolated while object is in motion). Does not call any natives.
+	/// </summary>
+	/// <returns>The object location.</returns>
+	virtual math::Vector3f getLocation() const override;
+
+	/// <summary>
+	/// Returns the object rotation (interpolated while object is in motion). Does not call any natives.
+	/// </summary>
+	/// <returns>The object rotation.</returns>
+	virtual math::Vector3f getRotation() const override;
 	
 	/// <summary>
 	/// Returns the distance squared to specified player.
@@ -79,6 +106,22 @@ public:
 	/// The object rotation for specified player.
 	/// </returns>
 	virtual math::Vector3f getRotationFor(Player const & player_) const override;
+
+	/// <summary>
+	/// Determines whether the object is spawned for specified player.
+	/// </summary>
+	/// <param name="player_">The player.</param>
+	/// <returns>
+	///		<c>true</c> if object is spawned for specified player; otherwise <c>false</c>.
+	/// </returns>
+	bool isSpawnedFor(Player const & player_) const;
+
+	/// <summary>
+	/// Returns number of players the object is spawned for.
+	/// </summary>
+	std::size_t getSpawnedCount() const {
+		return m_playerHandles.size();
+	}
 	
 	/// <summary>
 	/// Returns object type.
@@ -106,24 +149,21 @@ protected:
 	/// <param name="player_">The player.</param>
 	virtual void applyTexture(std::size_t const materialIndex_, Texture const & textureMaterial_, const Player * player_) override;
 	
-	using PlayerHandle = std::pair<Player const*, Int32>;
-	using HandlesContainer = std::vector < PlayerHandle >;
+	using HandlesContainer = PlayerHandleTable<Int32>;
 
 	/// <summary>
-	/// Finds the object handle for player inside the handle container.
+	/// Finds the object handle for player.
 	/// </summary>
 	/// <param name="player_">The player.</param>
-	/// <returns>Iterator of the handle container.</returns>
-	auto findHandleForPlayer(Player const & player_)
-	{
-		return std::find_if(m_playerHandles.begin(), m_playerHandles.end(),
-			[&player_](PlayerHandle const & pair_)
-			{
-				return pair_.first == &player_;
-			});
-	}
+	/// <returns>The handle (empty if object is not spawned for the player).</returns>
+	std::optional<Int32> findHandleForPlayer(Player const & player_) const;
+
+	/// <summary>
+	/// Starts the native motion for specified player handle, from current location towards the motion target.
+	/// </summary>
+	void applyMotion(std::size_t playerIndex_, Int32 handle_) const;
 
-	HandlesContainer m_playerHandles;
+	HandlesContainer m_playerHandles;	// Handles indexed with player index.
 };
 
 
@@ -0,0 +1,68 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Core/Coroutine.hpp>
+
+#ifdef SAMP_EDGENGINE_COROUTINES
+
+namespace samp_cpp
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+CoroutineFramePool::~CoroutineFramePool()
+{
+	for (auto frame : m_freeFrames)
+	{
+		while (frame)
+		{
+			auto next = frame->next;
+			::operator delete(frame);
+			frame = next;
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+CoroutineFramePool& CoroutineFramePool::instance()
+{
+	// Intentionally never destroyed: frames may still be released by schedulers
+	// that are destroyed during static destruction (e.g. the GameMode).
+	static CoroutineFramePool* pool = new CoroutineFramePool{};
+	return *pool;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void* CoroutineFramePool::allocate(std::size_t size_)
+{
+	if (size_ > MaxPooledSize)
+		return ::operator new(size_);
+
+	std::size_t const sizeClass = sizeClassOf(size_);
+	if (FreeFrame* frame = m_freeFrames[sizeClass])
+	{
+		m_freeFrames[sizeClass] = frame->next;
+		return frame;
+	}
+
+	// Allocate whole size class, so that the frame can be reused by any coroutine of that class.
+	return ::operator new((sizeClass + 1) * Granularity);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void CoroutineFramePool::deallocate(void* frame_, std::size_t size_) noexcept
+{
+	if (size_ > MaxPooledSize)
+	{
+		::operator delete(frame_);
+		return;
+	}
+
+	std::size_t const sizeClass = sizeClassOf(size_);
+
+	auto frame = static_cast<FreeFrame*>(frame_);
+	frame->next = m_freeFrames[sizeClass];
+	m_freeFrames[sizeClass] = frame;
+}
+
+}
+
+#endif
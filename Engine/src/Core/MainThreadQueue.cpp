@@ -0,0 +1,71 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Core/MainThreadQueue.hpp>
+
+namespace samp_cpp
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+MainThreadQueue::MainThreadQueue(std::size_t capacity_)
+	:
+	m_queue{ capacity_ },
+	m_drainBudget{ DefaultDrainBudget },
+	m_drainTimeBudget{ IUpdatable::Duration::zero() },
+	m_posted{ 0 },
+	m_rejected{ 0 },
+	m_executed{ 0 },
+	m_lastBacklog{ 0 },
+	m_peakBacklog{ 0 }
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+bool MainThreadQueue::post(FuncType func_)
+{
+	if (m_queue.tryPush(std::move(func_)))
+	{
+		m_posted.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	m_rejected.fetch_add(1, std::memory_order_relaxed);
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+std::size_t MainThreadQueue::drain()
+{
+	const_a backlog = m_queue.getSizeApprox();
+	m_peakBacklog = std::max(m_peakBacklog, backlog);
+
+	const_a deadline = IUpdatable::Clock::now() + m_drainTimeBudget;
+
+	std::size_t numExecuted = 0;
+	FuncType func;
+	while (numExecuted < m_drainBudget && m_queue.tryPop(func))
+	{
+		func();
+		++numExecuted;
+
+		if (m_drainTimeBudget != IUpdatable::Duration::zero() && IUpdatable::Clock::now() >= deadline)
+			break;
+	}
+
+	m_executed += numExecuted;
+	m_lastBacklog = m_queue.getSizeApprox();
+	return numExecuted;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+MainThreadQueue::Stats MainThreadQueue::getStats() const
+{
+	Stats stats;
+	stats.posted		= m_posted.load(std::memory_order_relaxed);
+	stats.rejected		= m_rejected.load(std::memory_order_relaxed);
+	stats.executed		= m_executed;
+	stats.lastBacklog	= m_lastBacklog;
+	stats.peakBacklog	= m_peakBacklog;
+	return stats;
+}
+
+}
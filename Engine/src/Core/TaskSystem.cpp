@@ -2,6 +2,10 @@
 
 #include <SAMPCpp/Core/TaskSystem.hpp>
 
+#ifdef SAMP_EDGENGINE_COROUTINES
+	#include <SAMPCpp/Core/Coroutine.hpp>
+#endif
+
 
 namespace samp_cpp
 {
@@ -13,7 +17,15 @@ Task::Task(IUpdatable::Duration interval_, FuncType func_, std::uintmax_t repeat
 	m_interval{ interval_ },
 	m_function{ func_ },
 	m_repeatCount{ repeatCount_ },
-	m_lastExecution{ IUpdatable::Clock::now() }
+	m_lastExecution{ IUpdatable::Clock::now() },
+	m_generation{ 0 },
+	m_nextFree{ TaskHandle::InvalidIndex }
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+Task::Task()
+	: Task{ IUpdatable::Duration::zero(), nullptr, 0 }
 {
 }
 
@@ -71,103 +83,307 @@ std::uintmax_t Task::getRepeatCount() const
 /////////////////////////////////////////////////////////////////////////////////////////////
 void TaskScheduler::update(double deltaTime_, IUpdatable::TimePoint timeMoment_)
 {
-	if (!m_tasks.empty())
+#ifdef SAMP_EDGENGINE_COROUTINES
+	this->resumeCoroutines(timeMoment_);
+#endif
+
+	if (m_tasks.empty())
+		return;
+
+	auto const laterFirst = [](QueueEntry const& left_, QueueEntry const& right_)
+		{
+			return left_.executionTime > right_.executionTime;
+		};
+
+	// Safety TODO: consider using RAII on m_performsInvoking.
+	m_performsTaskExecution = true;
+
+	// Invoke every ready action. Re-armed tasks go to m_pendingTasks so that
+	// a task with zero interval does not execute more than once per update.
+	while (!m_tasks.empty() && m_tasks.front().executionTime < timeMoment_)
 	{
-		// Calculate number of actions that must be fired.
-		ContainerType::size_type numReady = 0;
-		for (auto const & action : m_tasks)
+		std::pop_heap(m_tasks.begin(), m_tasks.end(), laterFirst);
+		TaskHandle const handle = m_tasks.back().task;
+		m_tasks.pop_back();
+
+		Task* task = this->get(handle);
+		if (!task)
+			continue; // Stale entry: task was cancelled.
+
+		if (task->getRepeatCount() > 0)
 		{
-			if (action->getNextExecutionTime() < timeMoment_)
-				numReady++;
-			else
-				break;
+			m_executedSlot = handle.index;
+			task->execute();
+			m_executedSlot = TaskHandle::InvalidIndex;
 		}
 
-		if (numReady > 0)
-		{
-			auto endIt = m_tasks.begin() + numReady;
+		// Note: `task` is still valid: deque does not relocate elements when growing at the end.
+		if (task->getRepeatCount() == 0)
+			this->releaseSlot(handle.index);
+		else
+			m_pendingTasks.push_back( QueueEntry{ task->getNextExecutionTime(), handle } );
+	}
+
+	m_performsTaskExecution = false;
 
-			// Invoke every ready action.
+	if (!m_pendingTasks.empty())
+	{
+		for (auto const & entry : m_pendingTasks)
+			this->enqueue(entry);
+
+		m_pendingTasks.clear();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::internalSchedule(IUpdatable::Duration interval_, Task::FuncType function_, std::uintmax_t repeatCount_)
+{
+	std::uint32_t const index = this->acquireSlot();
+
+	Task& task = m_pool[index];
+	task.m_running			= true;
+	task.m_interval			= interval_;
+	task.m_lastExecution	= IUpdatable::Clock::now();
+	task.m_repeatCount		= repeatCount_;
+	task.m_function			= std::move(function_);
+
+	TaskHandle handle{ index, task.m_generation };
+
+	QueueEntry entry{ task.getNextExecutionTime(), handle };
+	if (m_performsTaskExecution)
+		m_pendingTasks.push_back(entry);
+	else
+		this->enqueue(entry);
+
+	return handle;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+bool TaskScheduler::cancel(TaskHandle task_)
+{
+	Task* task = this->get(task_);
+	if (!task)
+		return false;
+
+	bool const wasScheduled = task->isRunning();
+
+	// Function of the task being executed must not be destroyed now,
+	// update() will release the slot once the execution finishes.
+	if (task_.index == m_executedSlot)
+		task->stop();
+#ifdef SAMP_EDGENGINE_COROUTINES
+	else if (task->m_coroutine)
+		this->destroyCoroutine(task_.index);
+#endif
+	else
+		this->releaseSlot(task_.index);
+
+	return wasScheduled;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+bool TaskScheduler::isScheduled(TaskHandle task_) const
+{
+	Task const* task = this->get(task_);
+	return task && task->isRunning();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+Task* TaskScheduler::get(TaskHandle task_)
+{
+	if (task_.index >= m_pool.size())
+		return nullptr;
+
+	Task& task = m_pool[task_.index];
+	return (task.m_generation == task_.generation && task.m_running) ? &task : nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+Task const* TaskScheduler::get(TaskHandle task_) const
+{
+	return const_cast<TaskScheduler*>(this)->get(task_);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+std::uint32_t TaskScheduler::acquireSlot()
+{
+	if (m_firstFree != TaskHandle::InvalidIndex)
+	{
+		std::uint32_t const index = m_firstFree;
+		m_firstFree = m_pool[index].m_nextFree;
+		m_pool[index].m_nextFree = TaskHandle::InvalidIndex;
+		return index;
+	}
+
+	m_pool.push_back(Task{});
+	return static_cast<std::uint32_t>(m_pool.size() - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::releaseSlot(std::uint32_t index_)
+{
+	Task& task = m_pool[index_];
+
+	task.m_running		= false;
+	task.m_repeatCount	= 0;
+	task.m_function		= nullptr;
+#ifdef SAMP_EDGENGINE_COROUTINES
+	task.m_coroutine	= nullptr;
+#endif
+	task.m_generation++;
+
+	task.m_nextFree = m_firstFree;
+	m_firstFree = index_;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::enqueue(QueueEntry entry_)
+{
+	m_tasks.push_back(entry_);
+	std::push_heap(m_tasks.begin(), m_tasks.end(),
+			[](QueueEntry const& left_, QueueEntry const& right_)
 			{
-				// Safety TODO: consider using RAII on m_performsInvoking.
-
-				m_performsTaskExecution = true;
-				for (auto it = m_tasks.begin(); it != endIt; ++it)
-				{
-					// *it is SharedPtr<Task>&
-					// *(*it) is Task&
-					if (it->use_count() > 1 && (*it)->getRepeatCount() > 0)
-						(*it)->execute();
-				}
-				m_performsTaskExecution = false;
+				return left_.executionTime > right_.executionTime;
 			}
+		);
+}
 
-			// Erase actions that mustn't be fired again.
-			m_tasks.erase(std::remove_if(m_tasks.begin(), endIt,
-					[](SharedPtr<Task> & task_)
-					{
-						if (task_.use_count() <= 1 || task_->getRepeatCount() == 0)
-						{
-							task_->m_running = false;
-							return true;
-						}
-						return false;
-					}
-				), endIt);
-
-
-			if (!m_pendingTasks.empty())
-			{
-				m_tasks.insert(m_tasks.end(), m_pendingTasks.begin(), m_pendingTasks.end());
+/////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef SAMP_EDGENGINE_COROUTINES
+TaskScheduler::~TaskScheduler()
+{
+	for (std::uint32_t i = 0; i < m_pool.size(); ++i)
+	{
+		if (m_pool[i].m_running && m_pool[i].m_coroutine)
+			this->destroyCoroutine(i);
+	}
+}
 
-				m_pendingTasks.clear();
+/////////////////////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::start(Coroutine coroutine_)
+{
+	std::uint32_t const index = this->acquireSlot();
+
+	Task& task = m_pool[index];
+	task.m_running		= true;
+	task.m_repeatCount	= 1;
+	task.m_coroutine	= coroutine_.release();
+
+	TaskHandle handle{ index, task.m_generation };
+
+	auto& promise = Coroutine::HandleType::from_address(task.m_coroutine.address()).promise();
+	promise.scheduler	= this;
+	promise.handle		= handle;
+
+	this->resumeCoroutine(handle);
+	return handle;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::start(ITaskOwner & owner_, Coroutine coroutine_)
+{
+	TaskHandle handle = this->start(std::move(coroutine_));
+	if (this->isScheduled(handle))
+		owner_.interceptTask(*this, handle);
+	return handle;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::resumeAt(IUpdatable::TimePoint timePoint_, TaskHandle coroutine_)
+{
+	m_sleepingCoroutines.push_back( SleepingCoroutine{ timePoint_, coroutine_ } );
+	std::push_heap(m_sleepingCoroutines.begin(), m_sleepingCoroutines.end(),
+			[](SleepingCoroutine const& left_, SleepingCoroutine const& right_)
+			{
+				return left_.wakeTime > right_.wakeTime;
 			}
+		);
+}
 
-			// Keep actions sorted.
-			std::sort(m_tasks.begin(), m_tasks.end(), 
-					[](SharedPtr<Task> const& left_, SharedPtr<Task> const& right_)
-					{
-						return left_->getNextExecutionTime() < right_->getNextExecutionTime();
-					}
-				);
-		}
-	}
+/////////////////////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::resumeNextTick(TaskHandle coroutine_)
+{
+	m_nextTickCoroutines.push_back(coroutine_);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
-SharedPtr<Task> TaskScheduler::internalSchedule(IUpdatable::Duration interval_, Task::FuncType function_, std::uintmax_t repeatCount_)
+void TaskScheduler::resumeCoroutines(IUpdatable::TimePoint timeMoment_)
 {
-	auto task = std::make_shared<Task>(interval_, function_, repeatCount_);
-	task->m_running = true;
-	if (m_performsTaskExecution) {
-		m_pendingTasks.push_back(task);
+	// Collect everything that is ready first. Coroutines resumed below may suspend again
+	// (even with zero delay) and must not be resumed twice during single update.
+	m_resumedCoroutines.clear();
+	m_resumedCoroutines.swap(m_nextTickCoroutines);
+
+	auto const laterFirst = [](SleepingCoroutine const& left_, SleepingCoroutine const& right_)
+		{
+			return left_.wakeTime > right_.wakeTime;
+		};
+
+	while (!m_sleepingCoroutines.empty() && m_sleepingCoroutines.front().wakeTime < timeMoment_)
+	{
+		std::pop_heap(m_sleepingCoroutines.begin(), m_sleepingCoroutines.end(), laterFirst);
+		m_resumedCoroutines.push_back(m_sleepingCoroutines.back().coroutine);
+		m_sleepingCoroutines.pop_back();
 	}
-	else {
-		m_tasks.insert(
-				std::upper_bound(m_tasks.begin(), m_tasks.end(), task, 
-					[](SharedPtr<Task> const& left_, SharedPtr<Task> const& right_)
-					{
-						return left_->getNextExecutionTime() < right_->getNextExecutionTime();
-					}
-				),
-				task
-			);
+
+	// Note: cannot use range-for, coroutine may start another one that ends up in this buffer.
+	for (std::size_t i = 0; i < m_resumedCoroutines.size(); ++i)
+		this->resumeCoroutine(m_resumedCoroutines[i]);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::resumeCoroutine(TaskHandle coroutine_)
+{
+	Task* task = this->get(coroutine_);
+	if (!task || !task->m_coroutine)
+		return; // Stale entry: coroutine was cancelled.
+
+	// Coroutine may start (or execute) another one, restore previous slot afterwards.
+	std::uint32_t const previousSlot = m_executedSlot;
+	m_executedSlot = coroutine_.index;
+	task->m_coroutine.resume();
+	m_executedSlot = previousSlot;
+
+	// Note: `task` is still valid: deque does not relocate elements when growing at the end.
+	if (task->m_coroutine.done() || task->getRepeatCount() == 0)
+	{
+		if (auto exception = this->destroyCoroutine(coroutine_.index))
+			onCoroutineException.emit(exception);
 	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+std::exception_ptr TaskScheduler::destroyCoroutine(std::uint32_t index_)
+{
+	auto coroutine = Coroutine::HandleType::from_address(m_pool[index_].m_coroutine.address());
 
-	return task;
+	std::exception_ptr exception = std::move(coroutine.promise().exception);
+	coroutine.destroy();
+	this->releaseSlot(index_);
+	return exception;
 }
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////
-void ITaskOwner::interceptTask(SharedPtr<Task> task_, bool cleanup_)
+ITaskOwner::~ITaskOwner()
+{
+	this->removeAllTasks();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+void ITaskOwner::interceptTask(TaskScheduler & scheduler_, TaskHandle task_, bool cleanup_)
 {
 	if (cleanup_)
 		cleanupEndedTasks();
-	m_tasks.push_back(task_);
+	m_tasks.push_back( OwnedTask{ &scheduler_, task_ } );
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 void ITaskOwner::removeAllTasks()
 {
+	for (auto const & owned : m_tasks)
+		owned.scheduler->cancel(owned.handle);
+
 	m_tasks.clear();
 }
 
@@ -175,9 +391,9 @@ void ITaskOwner::removeAllTasks()
 void ITaskOwner::cleanupEndedTasks()
 {
 	m_tasks.erase(std::remove_if(m_tasks.begin(), m_tasks.end(),
-			[](auto const& t_)
+			[](OwnedTask const& t_)
 			{
-				return !t_ || t_.use_count() < 2 || !t_->isRunning();
+				return !t_.scheduler->isScheduled(t_.handle);
 			}),
 			m_tasks.end()
 		);
@@ -0,0 +1,83 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Server/FramePipeline.hpp>
+#include <SAMPCpp/Server/GameMode.hpp>
+#include <SAMPCpp/Server/ServerDebugLog.hpp>
+
+namespace samp_cpp
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+FramePipeline::Duration FramePipeline::getRemainingBudget() const
+{
+	if (!m_currentPhase)
+		return Duration::max();
+
+	const_a budget = this->getStats(*m_currentPhase).budget;
+	if (budget == Duration::zero())
+		return Duration::max();
+
+	const_a elapsed = IUpdatable::Clock::now() - m_phaseStart;
+	return elapsed < budget ? budget - elapsed : Duration::zero();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void FramePipeline::resetStats()
+{
+	for (auto & phase : m_phases)
+	{
+		phase.stats.maxDuration		= Duration::zero();
+		phase.stats.overrunCount	= 0;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+std::string_view FramePipeline::getPhaseName(FramePhase phase_)
+{
+	switch(phase_)
+	{
+	case FramePhase::Input:			return "Input";
+	case FramePhase::Simulation:	return "Simulation";
+	case FramePhase::Streaming:		return "Streaming";
+	case FramePhase::Output:		return "Output";
+	}
+	return "Unknown";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void FramePipeline::beginPhase(FramePhase phase_)
+{
+	assert(!m_currentPhase);
+
+	m_currentPhase	= phase_;
+	m_phaseStart	= IUpdatable::Clock::now();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void FramePipeline::endPhase()
+{
+	assert(m_currentPhase);
+
+	const_a phase		= *m_currentPhase;
+	const_a duration	= IUpdatable::Clock::now() - m_phaseStart;
+	m_currentPhase.reset();
+
+	auto& stats = m_phases[static_cast<std::size_t>(phase)].stats;
+	stats.lastDuration = duration;
+	stats.maxDuration = std::max(stats.maxDuration, duration);
+
+	if (stats.budget != Duration::zero() && duration > stats.budget)
+	{
+		stats.overrunCount++;
+
+		EDGE_LOG_DEBUG(Warning, "Frame phase \"{0}\" took {1}us (budget: {2}us).",
+				getPhaseName(phase),
+				chrono::duration_cast<chrono::microseconds>(duration).count(),
+				chrono::duration_cast<chrono::microseconds>(stats.budget).count()
+			);
+
+		onPhaseOverrun.emit(phase, duration, stats.budget);
+	}
+}
+
+}
@@ -5,6 +5,7 @@
 #include <SAMPCpp/World/Streamer/Streamer.hpp>
 
 #include <SAMPCpp/Server/Server.hpp>
+#include <SAMPCpp/Server/ServerDebugLog.hpp>
 
 namespace samp_cpp
 {
@@ -22,6 +23,9 @@ IGameMode::IGameMode(ServerClass & server_)
 	#endif
 
 	server.onServerUpdate += { *this, &IGameMode::onServerUpdate };
+#ifdef SAMP_EDGENGINE_COROUTINES
+	tasks.onCoroutineException += { *this, &IGameMode::onCoroutineException };
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +33,22 @@ IGameMode::~IGameMode()
 {
 }
 
+#ifdef SAMP_EDGENGINE_COROUTINES
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void IGameMode::onCoroutineException(std::exception_ptr exception_)
+{
+	try {
+		std::rethrow_exception(exception_);
+	}
+	catch(std::exception & exc_) {
+		EDGE_LOG_DEBUG(Error, "Scripted sequence ended with an exception: {0}", exc_.what());
+	}
+	catch(...) {
+		EDGE_LOG_DEBUG(Error, "Scripted sequence ended with an unknown exception.");
+	}
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 UniquePtr<Player> IGameMode::newPlayerInstance(Int32 playerIndex_)
 {
@@ -0,0 +1,128 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Server/NameTagMatrix.hpp>
+#include <SAMPCpp/Server/PlayerPool.hpp>
+
+namespace samp_cpp
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+NameTagMatrix::NameTagMatrix()
+	:
+	m_desired(MaxSlots),
+	m_current(MaxSlots),
+	m_cursor{ 0 },
+	m_callBudget{ DefaultCallBudget }
+{
+	// Clients show every name tag by default.
+	for (std::size_t i = 0; i < MaxSlots; ++i)
+	{
+		m_desired[i].set();
+		m_current[i].set();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void NameTagMatrix::setVisible(std::size_t viewerIndex_, std::size_t targetIndex_, bool visible_)
+{
+	m_desired[targetIndex_].set(viewerIndex_, visible_);
+	m_dirtyTargets.set(targetIndex_);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void NameTagMatrix::setVisibleForEveryone(std::size_t targetIndex_, bool visible_)
+{
+	if (visible_)
+		m_desired[targetIndex_].set();
+	else
+		m_desired[targetIndex_].reset();
+
+	m_hiddenForEveryone.set(targetIndex_, !visible_);
+	m_dirtyTargets.set(targetIndex_);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void NameTagMatrix::update(PlayerPool const & players_)
+{
+	if (m_dirtyTargets.none())
+		return;
+
+	// Natives are sent only to connected viewers, others get the state when they connect.
+	Row connected;
+	for (auto player : players_.getPool())
+		connected.set(static_cast<std::size_t>(player->getIndex()));
+
+	const_a start = m_cursor;
+	std::size_t calls = 0;
+	for (std::size_t i = 0; i < MaxSlots && calls < m_callBudget; ++i)
+	{
+		const_a target = (start + i) % MaxSlots;
+
+		// Next update starts after this target, unless it is left unfinished.
+		m_cursor = (target + 1) % MaxSlots;
+
+		if (!m_dirtyTargets.test(target))
+			continue;
+
+		auto& desired = m_desired[target];
+		auto& current = m_current[target];
+
+		// Only connected targets can have name tags.
+		if (!connected.test(target))
+		{
+			m_dirtyTargets.reset(target);
+			continue;
+		}
+
+		Row diff = (desired ^ current) & connected;
+		for (std::size_t viewer = 0; viewer < MaxSlots && diff.any() && calls < m_callBudget; ++viewer)
+		{
+			if (!diff.test(viewer))
+				continue;
+
+			sampgdk::ShowPlayerNameTagForPlayer(static_cast<Int32>(viewer), static_cast<Int32>(target), desired.test(viewer));
+			current.set(viewer, desired.test(viewer));
+			diff.reset(viewer);
+			++calls;
+		}
+
+		if (diff.none())
+			m_dirtyTargets.reset(target);
+		else
+		{
+			// Budget exhausted, continue with this target next time.
+			m_cursor = target;
+			return;
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void NameTagMatrix::whenPlayerConnects(std::size_t playerIndex_)
+{
+	// New viewer sees every name tag, send those that should be hidden.
+	for (std::size_t target = 0; target < MaxSlots; ++target)
+	{
+		if (m_desired[target].test(playerIndex_) != m_current[target].test(playerIndex_))
+			m_dirtyTargets.set(target);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void NameTagMatrix::whenPlayerDisconnects(std::size_t playerIndex_)
+{
+	// As a target: next player in this slot starts with default visibility.
+	m_desired[playerIndex_].set();
+	m_current[playerIndex_].set();
+	m_hiddenForEveryone.reset(playerIndex_);
+	m_dirtyTargets.reset(playerIndex_);
+
+	// As a viewer: next player in this slot starts with client defaults.
+	for (std::size_t target = 0; target < MaxSlots; ++target)
+	{
+		m_desired[target].set(playerIndex_, !m_hiddenForEveryone.test(target));
+		m_current[target].set(playerIndex_);
+	}
+}
+
+}
@@ -8,6 +8,7 @@
 #include <SAMPCpp/Server/ServerDebugLog.hpp>
 
 #include <SAMPCpp/World/Vehicle.hpp>
+#include <SAMPCpp/World/PersonalObjectBatch.hpp>
 
 
 namespace samp_cpp
@@ -16,6 +17,7 @@ namespace samp_cpp
 ///////////////////////////////////////////////////////////////////////////
 Player::Player(IGameMode& gameMode_, IndexType const index_)
 	:
+	attachments{ *this },
 	m_gameMode{ gameMode_ },
 	m_index{ index_ }, m_existingStatus{ ExistingStatus::Spawning },
 	m_language{ 0 },
@@ -212,9 +214,107 @@ Int32 Player::getClientVehicle() const
 ///////////////////////////////////////////////////////////////////////////
 void Player::setExistingStatus(ExistingStatus status_)
 {
+	// Client resets health and armour on death and spawn.
+	if (status_ != m_existingStatus)
+	{
+		m_sentHealth.reset();
+		m_sentArmour.reset();
+	}
 	m_existingStatus = status_;
 }
 
+///////////////////////////////////////////////////////////////////////////
+void Player::recordWrite(PendingWrite write_)
+{
+	auto& players = m_gameMode.players;
+	if (players.isWriteCombiningEnabled())
+	{
+		if (m_pendingWrites == 0)
+			players.whenPlayerHasPendingWrites(*this);
+		m_pendingWrites |= write_;
+	}
+	else
+		this->applyWrite(write_, false);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void Player::flushWrites()
+{
+	for (Uint8 write = HealthWrite; write <= CashWrite; write <<= 1)
+	{
+		if (m_pendingWrites & write)
+			this->applyWrite(static_cast<PendingWrite>(write), true);
+	}
+	m_pendingWrites = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void Player::applyWrite(PendingWrite write_, bool skipUnchanged_)
+{
+	const_a index = this->getIndex();
+	switch(write_)
+	{
+	case HealthWrite:
+	{
+		if (m_existingStatus == ExistingStatus::Dead)
+			break;
+
+		// TODO: find better solution.
+		const_a health = (m_health <= 0.01f ? 0.f : m_health);
+
+		// Prefer value reported by the client, it might have changed since last write.
+		const_a clientHealth = m_state.health.isValid() ? std::optional<float>{ m_state.health.value } : m_sentHealth;
+		if (skipUnchanged_ && clientHealth == health)
+			break;
+
+		sampgdk_SetPlayerHealth(index, health);
+		m_sentHealth = health;
+		m_state.health.invalidate();
+		break;
+	}
+	case ArmourWrite:
+	{
+		if (m_existingStatus == ExistingStatus::Dead)
+			break;
+
+		const_a clientArmour = m_state.armour.isValid() ? std::optional<float>{ m_state.armour.value } : m_sentArmour;
+		if (skipUnchanged_ && clientArmour == m_armour)
+			break;
+
+		sampgdk_SetPlayerArmour(index, m_armour);
+		m_sentArmour = m_armour;
+		m_state.armour.invalidate();
+		break;
+	}
+	case ColorWrite:
+	{
+		if (skipUnchanged_ && m_sentColor == m_color.toInt32())
+			break;
+
+		sampgdk_SetPlayerColor(index, m_color.toInt32());
+		m_sentColor = m_color.toInt32();
+		break;
+	}
+	case ScoreWrite:
+	{
+		if (skipUnchanged_ && m_sentScore == m_score)
+			break;
+
+		sampgdk_SetPlayerScore(index, m_score);
+		m_sentScore = m_score;
+		break;
+	}
+	case CashWrite:
+	{
+		// Client cash can change without server's knowledge, always compare with current value.
+		const_a difference = m_cash - sampgdk_GetPlayerMoney(index);
+		if (difference != 0 || !skipUnchanged_)
+			sampgdk_GivePlayerMoney(index, difference);
+		break;
+	}
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////
 void Player::setVehicle(Vehicle * const vehicle_) {
 	//EDGE_LOG_DEBUG(Info, "Player {0} has vehicle set to {1}", this->getName(), vehicle_ ? vehicle_->getHandle() : Vehicle::InvalidHandle);
@@ -256,6 +356,42 @@ PersonalObject& Player::finalizePersonalObjectConstruction(UniquePtr<PersonalObj
 	return *objectPtr;
 }
 
+///////////////////////////////////////////////////////////////////////////
+std::vector<PersonalObject*> Player::constructPersonalObjects(PersonalObjectBatch const & batch_)
+{
+	const_a& entries	= batch_.getEntries();
+	const_a& materials	= batch_.getMaterials();
+
+	std::vector<PersonalObject*> result;
+	result.reserve(entries.size());
+	m_personalObjects.reserve(m_personalObjects.size() + entries.size());
+
+	auto materialIt = materials.begin();
+	for (std::size_t i = 0; i < entries.size(); ++i)
+	{
+		const_a& entry = entries[i];
+
+		auto object = this->beginPersonalObjectConstruction();
+		object->setModel(entry.modelIndex);
+		object->setLocation(entry.location);
+		object->setRotation(entry.rotation);
+		object->setDrawDistance(entry.drawDistance);
+
+		// Materials are sorted by object index, objects are not spawned yet so they are only stored.
+		for (; materialIt != materials.end() && materialIt->objectIndex == i; ++materialIt)
+		{
+			std::visit([&](auto const & material_) {
+					object->setMaterial(materialIt->materialIndex, material_);
+				}, materialIt->material);
+		}
+
+		result.push_back(object.get());
+		m_personalObjects.push_back(std::move(object));
+	}
+
+	GameMode->streamer->whenObjectsJoinMap(*this, result);
+	return result;
+}
 
 ///////////////////////////////////////////////////////////////////////////
 bool Player::removePersonalObject(PersonalObject& personalObject_)
@@ -271,8 +407,10 @@ bool Player::removePersonalObject(PersonalObject& personalObject_)
 		// Notify streamer that object has left the map:
 		GameMode->streamer->whenObjectLeavesMap(*it->get());
 
-		// Erase the object from the pool.
-		m_personalObjects.erase(it);
+		// Erase the object from the pool (order does not matter).
+		if (it != m_personalObjects.end() - 1)
+			*it = std::move(m_personalObjects.back());
+		m_personalObjects.pop_back();
 		return true;
 	}
 
@@ -301,10 +439,14 @@ bool Player::setName(std::string_view const name_, bool(*isNameValidProc_)(const
 				tempName += std::string(21 - tempName.length(), '_');
 
 			sampgdk_SetPlayerName(this->getIndex(), tempName.c_str());
-			sampgdk_SetPlayerName(this->getIndex(), newName.c_str());
 		}
-		else
-			sampgdk_SetPlayerName(this->getIndex(), newName.c_str());
+
+		// Keep cached name (and the name index) in sync, native returns 1 on success.
+		if (sampgdk_SetPlayerName(this->getIndex(), newName.c_str()) == 1)
+		{
+			m_name = std::move(newName);
+			m_gameMode.players.whenPlayerNameChanges(*this);
+		}
 		return true;
 	}
 	return false;
@@ -384,6 +526,7 @@ void Player::teleport(Teleport const & teleport_, Clock::Duration freezeTime_)
 void Player::setLocation(math::Vector3f const &location_)
 {
 	IWI3DNode::setLocation(location_);
+	m_state.location.invalidate();
 
 	if (m_existingStatus != ExistingStatus::Dead)
 		sampgdk_SetPlayerPos(this->getIndex(), location_.x, location_.y, location_.z);
@@ -394,12 +537,14 @@ void Player::setLocation(math::Vector3f const &location_)
 ///////////////////////////////////////////////////////////////////////////
 void Player::setVelocity(math::Vector3f const &velocity_)
 {
+	m_state.velocity.invalidate();
 	sampgdk_SetPlayerVelocity(this->getIndex(), velocity_.x, velocity_.y, velocity_.z);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::setFacingAngle(float const angle_)
 {
+	m_state.facingAngle.invalidate();
 	if (m_existingStatus != ExistingStatus::Dead)
 		sampgdk_SetPlayerFacingAngle(this->getIndex(), angle_);
 }
@@ -408,6 +553,7 @@ void Player::setFacingAngle(float const angle_)
 void Player::setWorld(Int32 const world_)
 {
 	IWI3DNode::setWorld(world_);
+	m_state.world.invalidate();
 
 	if (m_existingStatus != ExistingStatus::Dead)
 		sampgdk_SetPlayerVirtualWorld(this->getIndex(), world_);
@@ -419,6 +565,7 @@ void Player::setWorld(Int32 const world_)
 void Player::setInterior(Int32 const interior_)
 {
 	IWI3DNode::setInterior(interior_);
+	m_state.interior.invalidate();
 
 	if (m_existingStatus != ExistingStatus::Dead)
 		sampgdk_SetPlayerInterior(this->getIndex(), interior_);
@@ -448,14 +595,14 @@ void Player::setCameraLookAtLocation(math::Vector3f const & lookAtLocation_)
 void Player::setCash(Int32 cash_)
 {
 	m_cash = cash_;
-	sampgdk_GivePlayerMoney(this->getIndex(), m_cash - sampgdk_GetPlayerMoney(this->getIndex()));
+	this->recordWrite(CashWrite);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::setScore(Int32 score_)
 {
 	m_score = score_;
-	sampgdk_SetPlayerScore(this->getIndex(), m_score);
+	this->recordWrite(ScoreWrite);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -468,30 +615,21 @@ void Player::kick()
 void Player::setHealth(float const health_)
 {
 	m_health = health_;
-
-	if (m_existingStatus != ExistingStatus::Dead)
-	{
-		// TODO: find better solution.
-		if (health_ <= 0.01f)
-			sampgdk_SetPlayerHealth(this->getIndex(), 0);
-		else
-			sampgdk_SetPlayerHealth(this->getIndex(), m_health);
-	}
+	this->recordWrite(HealthWrite);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::setArmor(float const armour_)
 {
 	m_armour = armour_;
-
-	if (m_existingStatus != ExistingStatus::Dead)
-		sampgdk_SetPlayerArmour(this->getIndex(), m_armour);
+	this->recordWrite(ArmourWrite);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::setColor(Color const & color_)
 {
-	sampgdk_SetPlayerColor(this->getIndex(), color_.toInt32());
+	m_color = color_;
+	this->recordWrite(ColorWrite);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -500,6 +638,8 @@ void Player::setSkin(Int32 skin_)
 	m_skin = skin_;
 	if (this->isSpawned()) {
 		sampgdk_SetPlayerSkin(this->getIndex(), skin_);
+		// Client drops attached objects when skin changes.
+		attachments.reapply();
 	}
 }
 
@@ -540,16 +680,21 @@ void Player::freeze(Clock::Duration freezeDuration_, bool skipIfLower)
 
 	m_unfreezeTime = now + freezeDuration_;
 
-	m_unfreezeTask = this->getGameMode().tasks.schedule(
+	auto& tasks = this->getGameMode().tasks;
+	tasks.cancel(m_unfreezeTask);
+
+	m_unfreezeTask = tasks.schedule(
 			m_unfreezeTime - now,
 			[this] { this->unfreeze(); }
 		);
+	this->interceptTask(tasks, m_unfreezeTask);
 	sampgdk_TogglePlayerControllable(this->getIndex(), false);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::unfreeze()
 {
+	this->getGameMode().tasks.cancel(m_unfreezeTask);
 	m_unfreezeTask.reset();
 	m_unfreezeTime = Clock::now();
 	sampgdk_TogglePlayerControllable(this->getIndex(), true);
@@ -624,38 +769,37 @@ bool Player::isMarkerVisible() const
 ///////////////////////////////////////////////////////////////////////////
 void Player::showNameTagFor(Player const & player_)
 {
-	sampgdk::ShowPlayerNameTagForPlayer(player_.getIndex(), this->getIndex(), true);
+	m_gameMode.players.getNameTags().setVisible(player_.getIndex(), this->getIndex(), true);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::showNameTag()
 {
-	for(Int32 i = 0; i < sampgdk_GetPlayerPoolSize(); ++i)
-		sampgdk::ShowPlayerNameTagForPlayer(i, this->getIndex(), true);
+	m_gameMode.players.getNameTags().setVisibleForEveryone(this->getIndex(), true);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::hideNameTagFor(Player const & player_)
 {
-	sampgdk::ShowPlayerNameTagForPlayer(player_.getIndex(), this->getIndex(), false);
+	m_gameMode.players.getNameTags().setVisible(player_.getIndex(), this->getIndex(), false);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::hideNameTag()
 {
-	for(Int32 i = 0; i < sampgdk_GetPlayerPoolSize(); ++i)
-		sampgdk::ShowPlayerNameTagForPlayer(i, this->getIndex(), true);
+	m_gameMode.players.getNameTags().setVisibleForEveryone(this->getIndex(), false);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 bool Player::hasNameTagShownFor(Player const& player_) const
 {
-	return true; // TODO: implement this.
+	return m_gameMode.players.getNameTags().isVisible(player_.getIndex(), this->getIndex());
 }
 
 ///////////////////////////////////////////////////////////////////////////
 void Player::setWeaponSet(WeaponSet const & weaponSet_)
 {
+	m_state.weapon.invalidate();
 	sampgdk::ResetPlayerWeapons(this->getIndex());
 	for (auto &weapon : weaponSet_.getWeapons())
 	{
@@ -666,6 +810,8 @@ void Player::setWeaponSet(WeaponSet const & weaponSet_)
 ///////////////////////////////////////////////////////////////////////////
 void Player::addWeapon(Weapon const weapon_)
 {
+	// Given weapon is put in hand.
+	m_state.weapon.invalidate();
 	sampgdk_GivePlayerWeapon(this->getIndex(), weapon_.getTypeIndex(), weapon_.getAmmo());
 }
 
@@ -692,12 +838,18 @@ std::string Player::getClientName() const
 ///////////////////////////////////////////////////////////////////////////
 math::Vector3f Player::getLocation() const
 {
-	return (this->isInWorld() ? this->getClientLocation() : IWI3DNode::getLocation());
+	if (!this->isInWorld())
+		return IWI3DNode::getLocation();
+
+	return (m_state.location.isValid() ? m_state.location.value : this->getClientLocation());
 }
 
 ///////////////////////////////////////////////////////////////////////////
 math::Vector3f Player::getVelocity() const
 {
+	if (m_state.velocity.isValid())
+		return m_state.velocity.value;
+
 	math::Vector3f vel;
 	sampgdk_GetPlayerVelocity(this->getIndex(), &vel.x, &vel.y, &vel.z);
 	return vel;
@@ -706,13 +858,19 @@ math::Vector3f Player::getVelocity() const
 ///////////////////////////////////////////////////////////////////////////
 Int32 Player::getWorld() const
 {
-	return (this->isInWorld() ? this->getClientWorld() : IWI3DNode::getWorld());
+	if (!this->isInWorld())
+		return IWI3DNode::getWorld();
+
+	return (m_state.world.isValid() ? m_state.world.value : this->getClientWorld());
 }
 
 ///////////////////////////////////////////////////////////////////////////
 Int32 Player::getInterior() const
 {
-	return (this->isInWorld() ? this->getClientInterior() : IWI3DNode::getInterior());
+	if (!this->isInWorld())
+		return IWI3DNode::getInterior();
+
+	return (m_state.interior.isValid() ? m_state.interior.value : this->getClientInterior());
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -726,6 +884,9 @@ float Player::getFacingAngle() const
 {
 	if (this->isInWorld())
 	{
+		if (m_state.facingAngle.isValid())
+			return m_state.facingAngle.value;
+
 		float angle{ 0.f };
 		if (sampgdk_GetPlayerFacingAngle(static_cast< int >(this->getIndex()), &angle))
 			return angle;
@@ -778,6 +939,9 @@ float Player::getArmour() const
 ///////////////////////////////////////////////////////////////////////////
 Color Player::getColor() const
 {
+	if (m_pendingWrites & ColorWrite)
+		return m_color;
+
 	return Color{ static_cast< Uint32 >(sampgdk_GetPlayerColor(static_cast<Int32>(this->getIndex()))) };
 }
 
@@ -842,6 +1006,35 @@ WeaponSet Player::getWeaponSet() const
 	return result;
 }
 
+///////////////////////////////////////////////////////////////////////////
+Weapon::Type Player::getWeapon() const
+{
+	if (m_state.weapon.isValid())
+		return m_state.weapon.value;
+
+	return static_cast<Weapon::Type>( sampgdk_GetPlayerWeapon(static_cast< int >(this->getIndex())) );
+}
+
+///////////////////////////////////////////////////////////////////////////
+Int32 Player::getSpecialAction() const
+{
+	if (m_state.specialAction.isValid())
+		return m_state.specialAction.value;
+
+	return sampgdk_GetPlayerSpecialAction(static_cast< int >(this->getIndex()));
+}
+
+///////////////////////////////////////////////////////////////////////////
+PlayerStateSnapshot::KeyState Player::getKeys() const
+{
+	if (m_state.keys.isValid())
+		return m_state.keys.value;
+
+	PlayerStateSnapshot::KeyState keys;
+	sampgdk_GetPlayerKeys(static_cast< int >(this->getIndex()), &keys.keys, &keys.upDown, &keys.leftRight);
+	return keys;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 bool Player::isSpawned() const noexcept
 {
@@ -857,7 +1050,7 @@ bool Player::isSelectingClass() const noexcept
 ///////////////////////////////////////////////////////////////////////////
 bool Player::isFrozen() const noexcept
 {
-	return m_unfreezeTask != nullptr;
+	return !m_unfreezeTask.isNull();
 }
 
 ///////////////////////////////////////////////////////////////////////////
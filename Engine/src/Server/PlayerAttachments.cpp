@@ -0,0 +1,131 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Server/PlayerAttachments.hpp>
+#include <SAMPCpp/Server/Player.hpp>
+
+namespace samp_cpp
+{
+
+///////////////////////////////////////////////////////////////////////////
+bool AttachedObject::operator==(AttachedObject const & rhs_) const
+{
+	auto const equal = [](math::Vector3f const & l_, math::Vector3f const & r_)
+		{
+			return l_.x == r_.x && l_.y == r_.y && l_.z == r_.z;
+		};
+
+	return	modelIndex == rhs_.modelIndex &&
+			bone == rhs_.bone &&
+			equal(offset, rhs_.offset) &&
+			equal(rotation, rhs_.rotation) &&
+			equal(scale, rhs_.scale) &&
+			materialColor1 == rhs_.materialColor1 &&
+			materialColor2 == rhs_.materialColor2;
+}
+
+///////////////////////////////////////////////////////////////////////////
+PlayerAttachments::PlayerAttachments(Player & owner_)
+	:
+	m_owner{ owner_ }
+{
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::set(std::size_t slotIndex_, AttachedObject const & object_)
+{
+	assert(slotIndex_ < SlotCount);
+
+	m_desired[slotIndex_] = object_;
+	this->applySlot(slotIndex_);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::remove(std::size_t slotIndex_)
+{
+	assert(slotIndex_ < SlotCount);
+
+	m_desired[slotIndex_].reset();
+	this->applySlot(slotIndex_);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::clear()
+{
+	for (std::size_t i = 0; i < SlotCount; ++i)
+		this->remove(i);
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::optional<AttachedObject> const& PlayerAttachments::get(std::size_t slotIndex_) const
+{
+	static std::optional<AttachedObject> const none;
+
+	if (slotIndex_ >= SlotCount)
+		return none;
+	return m_desired[slotIndex_];
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool PlayerAttachments::isEmpty() const
+{
+	return std::none_of(m_desired.begin(), m_desired.end(),
+			[](auto const & slot_) { return slot_.has_value(); }
+		);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::reapply()
+{
+	m_applied.fill(std::nullopt);
+	for (std::size_t i = 0; i < SlotCount; ++i)
+		this->applySlot(i);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::reapplySlot(std::size_t slotIndex_)
+{
+	if (slotIndex_ >= SlotCount)
+		return;
+
+	m_applied[slotIndex_].reset();
+	this->applySlot(slotIndex_);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::whenEdited(std::size_t slotIndex_, AttachedObject const & object_)
+{
+	if (slotIndex_ >= SlotCount)
+		return;
+
+	m_desired[slotIndex_] = object_;
+	m_applied[slotIndex_] = object_;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void PlayerAttachments::applySlot(std::size_t slotIndex_)
+{
+	auto const & desired	= m_desired[slotIndex_];
+	auto & applied			= m_applied[slotIndex_];
+
+	if (desired == applied)
+		return;
+
+	const_a playerIndex	= static_cast<Int32>(m_owner.getIndex());
+	const_a slotIndex	= static_cast<Int32>(slotIndex_);
+	if (desired)
+	{
+		auto const & obj = *desired;
+		sampgdk_SetPlayerAttachedObject(playerIndex, slotIndex, obj.modelIndex, obj.bone,
+				obj.offset.x, obj.offset.y, obj.offset.z,
+				obj.rotation.x, obj.rotation.y, obj.rotation.z,
+				obj.scale.x, obj.scale.y, obj.scale.z,
+				obj.materialColor1, obj.materialColor2
+			);
+	}
+	else
+		sampgdk_RemovePlayerAttachedObject(playerIndex, slotIndex);
+
+	applied = desired;
+}
+
+}
@@ -0,0 +1,169 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Server/PlayerNameIndex.hpp>
+#include <SAMPCpp/Server/Player.hpp>
+#include <SAMPCpp/Core/Text/ASCII.hpp>
+
+namespace samp_cpp
+{
+
+namespace
+{
+
+/// <summary>
+/// Returns length of the common prefix of two strings.
+/// </summary>
+std::size_t commonPrefixLength(std::string_view const lhs_, std::string_view const rhs_)
+{
+	const_a minLength = std::min(lhs_.size(), rhs_.size());
+	std::size_t i = 0;
+	while (i < minLength && lhs_[i] == rhs_[i])
+		++i;
+	return i;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+PlayerNameIndex::PlayerNameIndex(std::size_t maxPlayers_)
+	:
+	m_lowerNames(maxPlayers_),
+	m_indexed(maxPlayers_, false)
+{
+	m_exact.reserve(maxPlayers_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerNameIndex::insert(Player & player_, std::string_view const name_)
+{
+	const_a index = static_cast<std::size_t>(player_.getIndex());
+	if (m_indexed[index])
+		this->remove(player_);
+
+	auto& lowerName = m_lowerNames[index];
+	lowerName = text::toLower(name_);
+	m_indexed[index] = true;
+
+	std::string_view const name{ lowerName };
+	m_exact[name] = &player_;
+
+	for (std::size_t offset = 0; offset < name.size(); ++offset)
+	{
+		Suffix suffix{ name.substr(offset), offset, &player_ };
+		m_suffixes.insert(
+				std::upper_bound(m_suffixes.begin(), m_suffixes.end(), suffix, &PlayerNameIndex::suffixLess),
+				suffix
+			);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerNameIndex::remove(Player const & player_)
+{
+	const_a index = static_cast<std::size_t>(player_.getIndex());
+	if (!m_indexed[index])
+		return;
+
+	std::string_view const name{ m_lowerNames[index] };
+
+	auto exactIt = m_exact.find(name);
+	if (exactIt != m_exact.end() && exactIt->second == &player_)
+		m_exact.erase(exactIt);
+
+	for (std::size_t offset = 0; offset < name.size(); ++offset)
+	{
+		Suffix const suffix{ name.substr(offset), offset, const_cast<Player*>(&player_) };
+		auto it = std::lower_bound(m_suffixes.begin(), m_suffixes.end(), suffix, &PlayerNameIndex::suffixLess);
+		if (it != m_suffixes.end() && it->player == &player_)
+			m_suffixes.erase(it);
+	}
+
+	m_indexed[index] = false;
+	m_lowerNames[index].clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerNameIndex::rename(Player & player_, std::string_view const newName_)
+{
+	this->remove(player_);
+	this->insert(player_, newName_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Player* PlayerNameIndex::findExact(std::string_view const name_) const
+{
+	auto it = m_exact.find( text::toLower(name_) );
+	return it != m_exact.end() ? it->second : nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Player* PlayerNameIndex::findBestMatch(std::string_view const fragment_, std::size_t const minimalScore_) const
+{
+	if (fragment_.empty() || m_suffixes.empty())
+		return nullptr;
+
+	const_a fragment = text::toLower(fragment_);
+
+	// Suffix sharing the longest prefix with the fragment is a neighbour of its insertion point.
+	auto it = std::lower_bound(m_suffixes.begin(), m_suffixes.end(), std::string_view{ fragment },
+			[](Suffix const & suffix_, std::string_view const text_) { return suffix_.text < text_; }
+		);
+
+	std::size_t score = 0;
+	if (it != m_suffixes.end())
+		score = commonPrefixLength(it->text, fragment);
+	if (it != m_suffixes.begin())
+		score = std::max(score, commonPrefixLength(std::prev(it)->text, fragment));
+
+	if (score == 0 || score < minimalScore_)
+		return nullptr;
+
+	// Every suffix with the same score lies in a contiguous range around `it`, pick player with lowest index.
+	Player* result = nullptr;
+	auto const consider = [&result](Player* player_)
+		{
+			if (!result || player_->getIndex() < result->getIndex())
+				result = player_;
+		};
+
+	for (auto fwd = it; fwd != m_suffixes.end() && commonPrefixLength(fwd->text, fragment) >= score; ++fwd)
+		consider(fwd->player);
+
+	for (auto bwd = it; bwd != m_suffixes.begin(); )
+	{
+		--bwd;
+		if (commonPrefixLength(bwd->text, fragment) < score)
+			break;
+		consider(bwd->player);
+	}
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<Player*> PlayerNameIndex::findByPrefix(std::string_view const prefix_) const
+{
+	const_a prefix = text::toLower(prefix_);
+
+	auto it = std::lower_bound(m_suffixes.begin(), m_suffixes.end(), std::string_view{ prefix },
+			[](Suffix const & suffix_, std::string_view const text_) { return suffix_.text < text_; }
+		);
+
+	std::vector<Player*> result;
+	for (; it != m_suffixes.end() && it->text.substr(0, prefix.size()) == prefix; ++it)
+	{
+		if (it->offset == 0)
+			result.push_back(it->player);
+	}
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool PlayerNameIndex::suffixLess(Suffix const & lhs_, Suffix const & rhs_)
+{
+	if (lhs_.text != rhs_.text)
+		return lhs_.text < rhs_.text;
+	return lhs_.player->getIndex() < rhs_.player->getIndex();
+}
+
+}
@@ -11,11 +11,16 @@ namespace samp_cpp
 
 //////////////////////////////////////////////////////////////////////////////
 PlayerPool::PlayerPool()
-	: maxPlayers( static_cast<std::size_t>(sampgdk_GetMaxPlayers()) )
+	:
+	m_spatialIndex{ SpatialIndexCellSize },
+	m_nameIndex{ static_cast<std::size_t>(sampgdk_GetMaxPlayers()) },
+	maxPlayers( static_cast<std::size_t>(sampgdk_GetMaxPlayers()) )
 {
-	m_playerPool.resize(maxPlayers);
-	m_playerRawPool.resize(maxPlayers, nullptr);
+	assert(maxPlayers <= MaxSlots);
+
 	m_connectedPlayers.reserve(maxPlayers);
+	m_pendingWritePlayers.reserve(maxPlayers);
+	m_indexedLocations.resize(maxPlayers);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -26,50 +31,31 @@ PlayerPool::~PlayerPool()
 //////////////////////////////////////////////////////////////////////////////
 Player * PlayerPool::get(std::size_t const playerIndex_) const
 {
-	if (playerIndex_ >= m_playerRawPool.size())
+	if (playerIndex_ >= MaxSlots)
 		return nullptr;
 		
-	return m_playerRawPool[playerIndex_];
+	return m_slots[playerIndex_].player.get();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 PlayerPool::RawPoolType PlayerPool::findEveryoneInRadius(math::Vector3f const location_, math::Meters const radius_)
 {
-	// Check if there is any player on the server.
-	if (m_connectedPlayers.empty())
-		return {};
-
-
 	auto result = RawPoolType{};
-	// Reserve memory for faster calculation
-	result.reserve(m_connectedPlayers.size());
 
-	for (const auto &player : m_connectedPlayers)
-	{
-		if(player->getDistanceTo(location_) <= radius_)
-			result.push_back(player);
-	}
-
-	// Cut reserved memory
-	result.resize(result.size());
+	m_spatialIndex.forEachInRadius(location_, static_cast<float>(radius_.value),
+			[&result](auto const & entry_)
+			{
+				result.push_back(entry_.value);
+			}
+		);
 	return result;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 Player * PlayerPool::findNearest(math::Vector3f const location_, math::Meters const radius_)
 {
-	// Check if there is any player on the server.
-	if (m_connectedPlayers.empty())
-		return nullptr;
-		
-	auto it = std::min_element(m_connectedPlayers.begin(), m_connectedPlayers.end(),
-		[&location_](Player *const lhs, Player *const rhs)
-	{
-		return lhs->getDistanceTo(location_) < rhs->getDistanceTo(location_);
-	});
-
-	// Make sure that nearest player is within radius; otherwise return null pointer.
-	return ((*it)->getDistanceTo(location_) <= radius_ ? *it : nullptr);
+	const_a nearest = m_spatialIndex.findNearest(location_, 1, static_cast<float>(radius_.value));
+	return nearest.empty() ? nullptr : nearest.front()->value;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -79,36 +65,81 @@ Player * PlayerPool::findNearest(Player const * const player_, math::Meters cons
 	if (m_connectedPlayers.size() < 2)
 		return nullptr;
 
-	// Cache the location.
-	const auto location = player_->getLocation();
+	// Use indexed location, so that the result is consistent with other players' locations.
+	const_a& indexed	= m_indexedLocations[ static_cast<std::size_t>(player_->getIndex()) ];
+	const_a location	= indexed ? *indexed : player_->getLocation();
+
+	const_a nearest = m_spatialIndex.findNearest(location, 1, static_cast<float>(radius_.value),
+			[player_](auto const & entry_)
+			{
+				return entry_.value != player_;
+			}
+		);
+	return nearest.empty() ? nullptr : nearest.front()->value;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+PlayerPool::RawPoolType PlayerPool::findKNearest(math::Vector3f const location_, std::size_t const count_, math::Meters const radius_)
+{
+	const_a nearest = m_spatialIndex.findNearest(location_, count_, static_cast<float>(radius_.value));
+
+	auto result = RawPoolType{};
+	result.reserve(nearest.size());
+	for (auto entry : nearest)
+		result.push_back(entry->value);
+	return result;
+}
 
-	auto it = std::min_element(m_connectedPlayers.begin(), m_connectedPlayers.end(),
-		[player_, &location](Player *const lhs, Player *const rhs)
-		{
-			// Make sure that player_ will always be at the end of the list.
-			if (lhs == player_)
-				return false;
-			if (rhs == player_)
-				return true;
+//////////////////////////////////////////////////////////////////////////////
+void PlayerPool::refreshSpatialIndex()
+{
+	m_spatialIndex.clear();
+
+	for (auto player : m_connectedPlayers)
+	{
+		// Snapshot was refreshed earlier in FramePhase::Input, so in most cases no native is called here.
+		const_a location = player->getLocation();
 
-			return lhs->getDistanceTo(location) < rhs->getDistanceTo(location);
-		});
+		m_indexedLocations[ static_cast<std::size_t>(player->getIndex()) ] = location;
+		m_spatialIndex.insert(location, player);
+	}
+}
 
-	// Make sure that nearest player is within radius; otherwise return null pointer.
-	return ((*it)->getDistanceTo(location) <= radius_ ? *it : nullptr);
+//////////////////////////////////////////////////////////////////////////////
+void PlayerPool::refreshStateSnapshots(PlayerStateSnapshot::FrameNumber frame_)
+{
+	for (auto player : m_connectedPlayers)
+	{
+		if (player->m_state.dirty)
+			player->m_state.capture(static_cast<Int32>(player->getIndex()), frame_);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerPool::setWriteCombining(bool enabled_)
+{
+	if (!enabled_)
+		this->flushPendingWrites();
+	m_writeCombining = enabled_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerPool::flushPendingWrites()
+{
+	for (auto player : m_pendingWritePlayers)
+		player->flushWrites();
+	m_pendingWritePlayers.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 Player * PlayerPool::findByName(std::string_view const name_, bool const caseSensitive_)
 {
-	return this->find(
-		[&name_, &caseSensitive_](Player *const player_)
-		{
-			if(caseSensitive_)
-				return text::equal(name_, player_->getName());
-			else
-				return text::equal<text::CaseInsensitive>(name_, player_->getName());
-		});
+	Player* player = m_nameIndex.findExact(name_);
+
+	// Index is case insensitive, check exact name if needed.
+	if (player && caseSensitive_ && !text::equal(name_, player->getName()))
+		return nullptr;
+	return player;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -136,51 +167,86 @@ Player * PlayerPool::findBestMatch(std::string_view const nameOrIndex_, std::siz
 
 	// Check if lookup failed and try to take best match.
 	if (!result)
-	{
-		std::size_t maxScore = 0;
-		for (const auto &player : m_connectedPlayers)
-		{
-			auto const [itMin, itMax] = text::searchWithIncomplete<text::CaseInsensitive>(player->getName(), nameOrIndex_);
-			auto const score = itMax - itMin;
-			if (score > maxScore && score >= minimalScore_)
-			{
-				result = player;
-				maxScore = score;
-			}
-		}
-	}
+		result = m_nameIndex.findBestMatch(nameOrIndex_, minimalScore_);
 	return result;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+PlayerPool::RawPoolType PlayerPool::findByNamePrefix(std::string_view const prefix_) const
+{
+	return m_nameIndex.findByPrefix(prefix_);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 Player& PlayerPool::whenPlayerConnectsEx(UniquePtr<Player>&& player_)
 {
 	const_a index = player_->getIndex();
 
-	m_playerPool[index] = std::forward< UniquePtr<Player> >(player_);
+	auto& slot = m_slots[index];
+	slot.player = std::forward< UniquePtr<Player> >(player_);
 	// Do not use player_ from now.
-	m_playerRawPool[index] = m_playerPool[index].get();
+	Player* player = slot.player.get();
+
+	slot.connectedIndex = m_connectedPlayers.size();
+	m_connectedPlayers.push_back(player);
+
+	// Index the player right away, it will be refreshed with the next tick.
+	const_a location = player->getLocation();
+	m_indexedLocations[index] = location;
+	m_spatialIndex.insert(location, player);
+
+	m_nameIndex.insert(*player, player->getName());
+	m_nameTags.whenPlayerConnects(static_cast<std::size_t>(index));
 		
-	return *m_connectedPlayers.emplace_back(m_playerRawPool[index]);
+	return *player;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void PlayerPool::whenPlayerDisconnectsEx(std::size_t const playerIndex_)
 {
-	// Remove from connected Players.
+	auto& slot = m_slots[playerIndex_];
+	Player* player = slot.player.get();
+
+	// Remove from connected Players (swap with the last one).
 	{
-		auto it = std::find_if(m_connectedPlayers.begin(), m_connectedPlayers.end(),
-			[playerIndex_](Player *const element)
-			{
-				return element->getIndex() == playerIndex_;
-			});
-		m_connectedPlayers.erase(it);
+		Player* last = m_connectedPlayers.back();
+		m_connectedPlayers[slot.connectedIndex] = last;
+		m_slots[ static_cast<std::size_t>(last->getIndex()) ].connectedIndex = slot.connectedIndex;
+		m_connectedPlayers.pop_back();
+	}
+
+	// Remove from the spatial index.
+	if (auto& indexed = m_indexedLocations[playerIndex_])
+	{
+		m_spatialIndex.remove(*indexed, player);
+		indexed.reset();
+	}
+
+	m_nameIndex.remove(*player);
+	m_nameTags.whenPlayerDisconnects(playerIndex_);
+
+	// Pending writes are pointless now.
+	if (player->m_pendingWrites != 0)
+	{
+		auto it = std::find(m_pendingWritePlayers.begin(), m_pendingWritePlayers.end(), player);
+		if (it != m_pendingWritePlayers.end())
+			m_pendingWritePlayers.erase(it);
 	}
 
-	// Reset raw pointer.
-	m_playerRawPool[playerIndex_] = nullptr;
 	// Reset the smart pointer.
-	m_playerPool[playerIndex_].reset();
+	slot.player.reset();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerPool::whenPlayerNameChanges(Player & player_)
+{
+	m_nameIndex.rename(player_, player_.getName());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PlayerPool::whenPlayerHasPendingWrites(Player & player_)
+{
+	m_pendingWritePlayers.push_back(&player_);
 }
 
 }
@@ -0,0 +1,58 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/Server/PlayerStateSnapshot.hpp>
+
+namespace samp_cpp
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void PlayerStateSnapshot::capture(Int32 playerIndex_, FrameNumber frame_)
+{
+	math::Vector3f vec;
+
+	sampgdk_GetPlayerPos(playerIndex_, &vec.x, &vec.y, &vec.z);
+	location = { vec, frame_ };
+
+	sampgdk_GetPlayerVelocity(playerIndex_, &vec.x, &vec.y, &vec.z);
+	velocity = { vec, frame_ };
+
+	float value = 0.f;
+	sampgdk_GetPlayerFacingAngle(playerIndex_, &value);
+	facingAngle = { value, frame_ };
+
+	world		= { sampgdk_GetPlayerVirtualWorld(playerIndex_), frame_ };
+	interior	= { sampgdk_GetPlayerInterior(playerIndex_), frame_ };
+
+	sampgdk_GetPlayerHealth(playerIndex_, &value);
+	health = { value, frame_ };
+
+	sampgdk_GetPlayerArmour(playerIndex_, &value);
+	armour = { value, frame_ };
+
+	weapon			= { static_cast<Weapon::Type>( sampgdk_GetPlayerWeapon(playerIndex_) ), frame_ };
+	specialAction	= { sampgdk_GetPlayerSpecialAction(playerIndex_), frame_ };
+
+	KeyState keyState;
+	sampgdk_GetPlayerKeys(playerIndex_, &keyState.keys, &keyState.upDown, &keyState.leftRight);
+	keys = { keyState, frame_ };
+
+	dirty = false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void PlayerStateSnapshot::invalidate()
+{
+	location.invalidate();
+	velocity.invalidate();
+	facingAngle.invalidate();
+	world.invalidate();
+	interior.invalidate();
+	health.invalidate();
+	armour.invalidate();
+	weapon.invalidate();
+	specialAction.invalidate();
+	keys.invalidate();
+	dirty = true;
+}
+
+}
@@ -699,16 +699,50 @@ void ServerClass::sampEvent_OnUpdate()
 	double deltaTime = std::chrono::duration_cast<seconds_d>(frameTime - m_lastUpdate).count();
 	m_lastUpdate = frameTime;
 
-	if (GameMode)
-	{
-		if (Server->m_nextCheckpointUpdate < frameTime)
-		{
-			Server->m_nextCheckpointUpdate = frameTime + ServerClass::CheckpointUpdateInterval;
-			Server->updateCheckpoints();
-		}
-	}
+	auto& pipeline = Server->pipeline;
+	pipeline.beginFrame();
+
+	pipeline.runPhase(FramePhase::Input, deltaTime, frameTime,
+			[&]
+			{
+				Server->mainThread.drain();
+
+				if (GameMode)
+				{
+					GameMode->players.refreshStateSnapshots(pipeline.getFrameNumber());
+					GameMode->players.refreshSpatialIndex();
+					GameMode->regions.update(GameMode->players);
+				}
+
+				if (GameMode && Server->m_nextCheckpointUpdate < frameTime)
+				{
+					Server->m_nextCheckpointUpdate = frameTime + ServerClass::CheckpointUpdateInterval;
+					Server->updateCheckpoints();
+				}
+
+				Server->onPlayerUpdateDeferred.flush();
+			}
+		);
+
+	pipeline.runPhase(FramePhase::Simulation, deltaTime, frameTime,
+			[&]
+			{
+				Server->onServerUpdate.emit(deltaTime, frameTime);
+			}
+		);
 
-	Server->onServerUpdate.emit(deltaTime, frameTime);
+	pipeline.runPhase(FramePhase::Streaming, deltaTime, frameTime);
+	pipeline.runPhase(FramePhase::Output, deltaTime, frameTime,
+			[&]
+			{
+				if (GameMode)
+				{
+					GameMode->players.flushPendingWrites();
+					GameMode->players.getNameTags().update(GameMode->players);
+					GameMode->map.applyPendingBuildingRemovals();
+				}
+			}
+		);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -750,6 +784,7 @@ bool ServerClass::sampEvent_OnPlayerDisconnect(Int32 playerIndex_, Player::Disco
 	auto& player = *GameMode->players[static_cast<std::size_t>(playerIndex_)];
 
 	Server->onPlayerDisconnect.emit(player, reason_);
+	Server->onPlayerUpdateDeferred.discard(static_cast<std::size_t>(playerIndex_));
 
 	for (auto textDraw : GameMode->getTextDrawsAllowNull())
 	{
@@ -765,6 +800,7 @@ bool ServerClass::sampEvent_OnPlayerDisconnect(Int32 playerIndex_, Player::Disco
 	}
 
 	GameMode->streamer->whenPlayerLeavesServer(player);
+	GameMode->regions.whenPlayerDisconnects(player);
 	GameMode->players.whenPlayerDisconnectsEx(static_cast<std::size_t>(playerIndex_));
 	return true;
 }
@@ -773,6 +809,8 @@ bool ServerClass::sampEvent_OnPlayerDisconnect(Int32 playerIndex_, Player::Disco
 bool ServerClass::sampEvent_OnPlayerSpawn(Int32 playerIndex_)
 {
 	auto& player = *GameMode->players[static_cast<std::size_t>(playerIndex_)];
+	// Spawning moves the player without any setter, drop what was read before.
+	player.m_state.invalidate();
 	player.setHealth(100);
 	auto skin = player.getSkin();
 	player.setExistingStatus( Player::ExistingStatus::Spawning );
@@ -951,8 +989,17 @@ bool ServerClass::sampEvent_OnPlayerStateChange(Int32 playerIndex_, Int32 newSta
 /////////////////////////////////////////////////////////////////////////////////////////
 bool ServerClass::sampEvent_OnPlayerEnterCheckpoint(Int32 playerIndex_)
 {
-	Server->onPlayerEnterCheckpoint.emit( *GameMode->players[playerIndex_] );
+	auto& player = *GameMode->players[playerIndex_];
+	Server->onPlayerEnterCheckpoint.emit( player );
 
+	// Player reached current route checkpoint, show the next one.
+	if (player.checkpoints.isRouteMode() && !player.checkpoints.isEmpty())
+	{
+		if (player.checkpoints.advance())
+			player.setCheckpoint(player.checkpoints.get(player.checkpoints.getCurrentIndex()));
+		else
+			player.removeCheckpoint();
+	}
 	return true;
 }
 
@@ -966,7 +1013,17 @@ bool ServerClass::sampEvent_OnPlayerLeaveCheckpoint(Int32 playerIndex_)
 /////////////////////////////////////////////////////////////////////////////////////////
 bool ServerClass::sampEvent_OnPlayerEnterRaceCheckpoint(Int32 playerIndex_)
 {
-	Server->onPlayerEnterRaceCheckpoint.emit( *GameMode->players[playerIndex_] );
+	auto& player = *GameMode->players[playerIndex_];
+	Server->onPlayerEnterRaceCheckpoint.emit( player );
+
+	// Player reached current route checkpoint, show the next one.
+	if (player.raceCheckpoints.isRouteMode() && !player.raceCheckpoints.isEmpty())
+	{
+		if (player.raceCheckpoints.advance())
+			player.setRaceCheckpoint(player.raceCheckpoints.get(player.raceCheckpoints.getCurrentIndex()));
+		else
+			player.removeRaceCheckpoint();
+	}
 	return true;
 }
 
@@ -1093,7 +1150,9 @@ bool ServerClass::sampEvent_OnRconLoginAttempt(std::string_view IP_, std::string
 bool ServerClass::sampEvent_OnPlayerUpdate(Int32 playerIndex_)
 {
 	auto& player = *GameMode->players[playerIndex_];
+	player.m_state.dirty = true;
 	Server->onPlayerUpdate.emit(player);
+	Server->onPlayerUpdateDeferred.post(static_cast<std::size_t>(playerIndex_), player);
 	return true;
 }
 
@@ -1238,6 +1297,29 @@ bool ServerClass::sampEvent_OnPlayerEditPlayerObject(Int32 playerIndex_, Int32 o
 /////////////////////////////////////////////////////////////////////////////////////////
 bool ServerClass::sampEvent_OnPlayerEditAttachedObject(Int32 playerIndex_, bool applied_, Int32 slotIndex_, Int32 modelIndex_, Int32 boneIndex_, math::Vector3f offset_, math::Vector3f rotation_, math::Vector3f scale_)
 {
+	// Slot index comes from the client.
+	if (slotIndex_ < 0 || static_cast<std::size_t>(slotIndex_) >= PlayerAttachments::SlotCount)
+		return true;
+
+	auto& player = *GameMode->players[playerIndex_];
+	auto& attachments = player.attachments;
+
+	if (applied_)
+	{
+		// Client already shows edited object, keep the slot in sync without calling natives.
+		AttachedObject edited;
+		if (auto const & previous = attachments.get(static_cast<std::size_t>(slotIndex_)))
+			edited = *previous;
+
+		edited.modelIndex	= modelIndex_;
+		edited.bone			= boneIndex_;
+		edited.offset		= offset_;
+		edited.rotation		= rotation_;
+		edited.scale		= scale_;
+		attachments.whenEdited(static_cast<std::size_t>(slotIndex_), edited);
+	}
+	else // Client does not revert cancelled edition by itself.
+		attachments.reapplySlot(static_cast<std::size_t>(slotIndex_));
 	return true;
 }
 
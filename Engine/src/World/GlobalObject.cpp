@@ -5,6 +5,7 @@
 
 // Other headers:
 #include <SAMPCpp/Server/Player.hpp>
+#include <SAMPCpp/Server/GameMode.hpp>
 
 namespace samp_cpp
 {
@@ -54,7 +55,13 @@ bool GlobalObject::spawn()
 		if (m_handle != InvalidHandle)
 			sampgdk_DestroyObject(m_handle);
 
-		m_handle = sampgdk_CreateObject(m_modelIndex, m_storedLocation.x, m_storedLocation.y, m_storedLocation.z, m_rotation.x, m_rotation.y, m_rotation.z, m_drawDistance);
+		// Object in motion is created in its current (in-flight) transform and continues the motion.
+		const_a location = this->getLocation();
+		const_a rotation = this->getRotation();
+		m_handle = sampgdk_CreateObject(m_modelIndex, location.x, location.y, location.z, rotation.x, rotation.y, rotation.z, m_drawDistance);
+
+		if (this->isInMotion())
+			this->applyMotion();
 	}
 	return this->isSpawned();
 }
@@ -75,6 +82,9 @@ void GlobalObject::setModel(Int32 const modelIndex_)
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void GlobalObject::setLocation(math::Vector3f const & location_)
 {
+	if (m_motion)
+		this->stopMoving();
+
 	I3DNode::setLocation(location_);
 
 	if (m_handle != InvalidHandle) {
@@ -85,6 +95,9 @@ void GlobalObject::setLocation(math::Vector3f const & location_)
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void GlobalObject::setRotation(math::Vector3f const & rotationAxes_)
 {
+	if (m_motion)
+		this->stopMoving();
+
 	IMapObject::setRotation(rotationAxes_);
 
 	if (m_handle != InvalidHandle) {
@@ -93,27 +106,62 @@ void GlobalObject::setRotation(math::Vector3f const & rotationAxes_)
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-math::Vector3f GlobalObject::getLocation() const
+void GlobalObject::moveTo(math::Vector3f const & targetLocation_, float const speed_, std::optional<math::Vector3f> const & targetRotation_)
 {
+	this->settleMotion();
+	m_motion = ObjectMotion::begin(m_storedLocation, m_rotation, targetLocation_, targetRotation_, speed_, IUpdatable::Clock::now());
+
 	if (m_handle != InvalidHandle)
+		this->applyMotion();
+
+	// Streamer keeps the placement up to date while the object moves.
+	if (m_placementTracker)
 	{
-		math::Vector3f location;
-		sampgdk_GetObjectPos(m_handle, &location.x, &location.y, &location.z);
-		return location;
+		this->sendPlacementUpdate();
+		GameMode->streamer->whenObjectStartsMoving(*this);
 	}
-	return I3DNode::getLocation();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-math::Vector3f GlobalObject::getRotation() const
+void GlobalObject::stopMoving()
 {
-	if (m_handle != InvalidHandle)
+	if (!m_motion)
+		return;
+
+	const_a wasMoving = this->isInMotion();
+	this->settleMotion();
+
+	if (wasMoving && m_handle != InvalidHandle)
 	{
-		math::Vector3f rotation;
-		sampgdk_GetObjectRot(m_handle, &rotation.x, &rotation.y, &rotation.z);
-		return rotation;
+		// Keep the client in sync with the tracked transform.
+		sampgdk_StopObject(m_handle);
+		sampgdk_SetObjectPos(m_handle, m_storedLocation.x, m_storedLocation.y, m_storedLocation.z);
+		sampgdk_SetObjectRot(m_handle, m_rotation.x, m_rotation.y, m_rotation.z);
 	}
-	return IMapObject::getRotation();
+
+	this->sendPlacementUpdate();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void GlobalObject::applyMotion()
+{
+	const_a& motion		= *m_motion;
+	const_a rotation	= motion.targetRotation.value_or(math::Vector3f{ cxKeepMotionRotation, cxKeepMotionRotation, cxKeepMotionRotation });
+
+	sampgdk_MoveObject(m_handle, motion.targetLocation.x, motion.targetLocation.y, motion.targetLocation.z, motion.speed,
+		rotation.x, rotation.y, rotation.z);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+math::Vector3f GlobalObject::getLocation() const
+{
+	return this->getTrackedLocation();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+math::Vector3f GlobalObject::getRotation() const
+{
+	return this->getTrackedRotation();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -12,12 +12,14 @@ namespace samp_cpp
 MapClass::MapClass()
 {
 	Server->onPlayerConnect += { *this, &MapClass::whenPlayerConnects };
+	Server->onPlayerSpawn += { *this, &MapClass::whenPlayerSpawns };
+	Server->onPlayerDisconnect += { *this, &MapClass::whenPlayerDisconnects };
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
 Vehicle& MapClass::finalizeConstruction(ActorPtrType< Vehicle > const& vehicle_)
 {
-	m_vehicles.push_back(vehicle_);
+	m_vehicles.insert(vehicle_);
 	GameMode->streamer->whenVehicleJoinsMap(*vehicle_);
 	return *vehicle_;
 }
@@ -25,7 +27,7 @@ Vehicle& MapClass::finalizeConstruction(ActorPtrType< Vehicle > const& vehicle_)
 ///////////////////////////////////////////////////////////////////////////////////////
 StaticVehicle& MapClass::finalizeConstruction(ActorPtrType< StaticVehicle > const& staticVehicle_)
 {
-	m_staticVehicles.push_back(staticVehicle_);
+	m_staticVehicles.insert(staticVehicle_);
 	GameMode->streamer->whenStaticVehicleJoinsMap(*staticVehicle_);
 	return *staticVehicle_;
 }
@@ -33,19 +35,12 @@ StaticVehicle& MapClass::finalizeConstruction(ActorPtrType< StaticVehicle > cons
 ///////////////////////////////////////////////////////////////////////////////////////
 Scene& MapClass::finalizeConstruction(ActorPtrType< Scene > const& scene_)
 {
-	m_scenes.push_back(scene_);
+	m_scenes.insert(scene_);
 	scene_->whenSceneIsAddedToMap();
 
-	if (scene_->getRemovedBuildings().size() > 0)
-	{
-		auto const& removed = scene_->getRemovedBuildings();
-
-		m_removedBuildings.shrink_to_fit();
-		m_removedBuildings.reserve(removed.size());
-
-		for (auto const & building : removed)
-			this->removeBuilding(building);
-	}
+	// Map files often repeat overlapping removals, drop the redundant ones before they reach players.
+	for (auto const & building : RemovedBuildingSet::coalesce(scene_->getRemovedBuildings()))
+		this->removeBuilding(building);
 
 	return *scene_;
 }
@@ -53,14 +48,14 @@ Scene& MapClass::finalizeConstruction(ActorPtrType< Scene > const& scene_)
 ///////////////////////////////////////////////////////////////////////////////////////
 GangZone& MapClass::finalizeConstruction(ActorPtrType< GangZone > const& gangZone_)
 {
-	m_gangZones.push_back(gangZone_);
+	m_gangZones.insert(gangZone_);
 	return *gangZone_;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
 Checkpoint& MapClass::finalizeConstruction(ActorPtrType< Checkpoint > const& checkpoint_)
 {
-	m_checkpoints.push_back(checkpoint_);
+	m_checkpoints.insert(checkpoint_);
 	GameMode->streamer->whenCheckpointJoinsMap(*checkpoint_);
 	return *checkpoint_;
 }
@@ -68,7 +63,7 @@ Checkpoint& MapClass::finalizeConstruction(ActorPtrType< Checkpoint > const& che
 ///////////////////////////////////////////////////////////////////////////////////////
 RaceCheckpoint& MapClass::finalizeConstruction(ActorPtrType< RaceCheckpoint > const& raceCheckpoint_)
 {
-	m_raceCheckpoints.push_back(raceCheckpoint_);
+	m_raceCheckpoints.insert(raceCheckpoint_);
 	GameMode->streamer->whenCheckpointJoinsMap(*raceCheckpoint_);
 	return *raceCheckpoint_;
 }
@@ -76,34 +71,37 @@ RaceCheckpoint& MapClass::finalizeConstruction(ActorPtrType< RaceCheckpoint > co
 ///////////////////////////////////////////////////////////////////////////////////////
 bool MapClass::remove(Vehicle & vehicle_)
 {
-	auto it = std::find_if(m_vehicles.begin(), m_vehicles.end(),
-			[&vehicle_](auto const& vehPtr_) {
-				return vehPtr_.get() == &vehicle_;
-			}
-		);
-	
-	if (it != m_vehicles.end())
+	if (m_vehicles.contains(vehicle_))
 	{
 		GameMode->streamer->whenVehicleLeavesMap(vehicle_);
-		m_vehicles.erase(it);
+		m_vehicles.remove(vehicle_);
 		return true;
 	}
-	return this->remove(dynamic_cast<StaticVehicle&>(vehicle_));
+
+	if (auto staticVehicle = dynamic_cast<StaticVehicle*>(&vehicle_))
+		return this->remove(*staticVehicle);
+	return false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
 bool MapClass::remove(StaticVehicle & vehicle_)
 {
-	auto it = std::find_if(m_staticVehicles.begin(), m_staticVehicles.end(),
-			[&vehicle_](auto const& vehPtr_) {
-				return vehPtr_.get() == &vehicle_;
-			}
-		);
-	
-	if (it != m_staticVehicles.end())
+	if (m_staticVehicles.contains(vehicle_))
 	{
 		GameMode->streamer->whenStaticVehicleLeavesMap(vehicle_);
-		m_staticVehicles.erase(it);
+		m_staticVehicles.remove(vehicle_);
+		return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+bool MapClass::remove(Scene & scene_)
+{
+	if (m_scenes.contains(scene_))
+	{
+		scene_.whenSceneIsRemovedFromMap();
+		m_scenes.remove(scene_);
 		return true;
 	}
 	return false;
@@ -112,15 +110,29 @@ bool MapClass::remove(StaticVehicle & vehicle_)
 ///////////////////////////////////////////////////////////////////////////////////////
 bool MapClass::remove(GangZone const & gangZone_)
 {
-	const_a it = std::find_if(m_gangZones.begin(), m_gangZones.end(),
-		[&](auto const & e)
-		{
-			return &gangZone_ == e.get();
-		});
+	return static_cast<bool>( m_gangZones.remove(gangZone_) );
+}
 
-	if (it != m_gangZones.end())
+///////////////////////////////////////////////////////////////////////////////////////
+bool MapClass::remove(Checkpoint const & checkpoint_)
+{
+	if (m_checkpoints.contains(checkpoint_))
 	{
-		m_gangZones.erase(it);
+		// Removal keeps the checkpoint alive until streamer lets go of it.
+		auto checkpoint = m_checkpoints.remove(checkpoint_);
+		GameMode->streamer->whenCheckpointLeavesMap(*checkpoint);
+		return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+bool MapClass::remove(RaceCheckpoint const & raceCheckpoint_)
+{
+	if (m_raceCheckpoints.contains(raceCheckpoint_))
+	{
+		auto raceCheckpoint = m_raceCheckpoints.remove(raceCheckpoint_);
+		GameMode->streamer->whenRaceCheckpointLeavesMap(*raceCheckpoint);
 		return true;
 	}
 	return false;
@@ -130,53 +142,73 @@ bool MapClass::remove(GangZone const & gangZone_)
 Vehicle* MapClass::findVehicleByHandle(Int32 const vehicleHandle_)
 {
 	// Do not allow for such "hacks" (getting first not-spawned vehicle).
-	if (vehicleHandle_ == Vehicle::InvalidHandle)
+	if (vehicleHandle_ < 0 || vehicleHandle_ >= static_cast<Int32>(m_vehiclesByHandle.size()))
 		return nullptr;
 
-	Vehicle* result = nullptr;
-	// Find inside normal vehicles:
-	{
-		const_a it = std::find_if(m_vehicles.begin(), m_vehicles.end(),
-			[vehicleHandle_]
-			(ActorPtrType<Vehicle> const& veh_)
-			{
-				return veh_->getHandle() == vehicleHandle_;
-			});
-
-		result = (it != m_vehicles.end() ? it->get() : nullptr);
-	}
-	// If not found, try to find it inside static vehicles:
-	if (!result)
-	{
-		const_a it = std::find_if(m_staticVehicles.begin(), m_staticVehicles.end(),
-			[vehicleHandle_]
-			(ActorPtrType<StaticVehicle> const& veh_)
-			{
-				return veh_->getHandle() == vehicleHandle_;
-			});
+	return m_vehiclesByHandle[vehicleHandle_];
+}
 
-		result = (it != m_staticVehicles.end() ? it->get() : nullptr);
-	}
+///////////////////////////////////////////////////////////////////////////////////////
+void MapClass::whenVehicleSpawns(Vehicle & vehicle_)
+{
+	const_a handle = vehicle_.getHandle();
+	if (handle >= 0 && handle < static_cast<Int32>(m_vehiclesByHandle.size()))
+		m_vehiclesByHandle[handle] = &vehicle_;
+}
 
-	return result;
+///////////////////////////////////////////////////////////////////////////////////////
+void MapClass::whenVehicleDespawns(Vehicle & vehicle_)
+{
+	const_a handle = vehicle_.getHandle();
+	if (handle >= 0 && handle < static_cast<Int32>(m_vehiclesByHandle.size()) && m_vehiclesByHandle[handle] == &vehicle_)
+		m_vehiclesByHandle[handle] = nullptr;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
 void MapClass::removeBuilding(RemovedBuilding const& removedBuilding_)
 {
-	auto const it = std::find_if(m_removedBuildings.begin(), m_removedBuildings.end(),
-		[&removedBuilding_](RemovedBuilding const &element_)
+	if (m_removedBuildings.add(removedBuilding_))
+	{
+		for(auto & player : GameMode->players.getPool())
 		{
-			return element_ == removedBuilding_;
-		});
+			auto& pending = m_pendingRemovals[player->getIndex()];
+			pending.queue.push_back(removedBuilding_);
+			pending.sorted = false;
+		}
+	}
+}
 
-	if (it == m_removedBuildings.end())
+///////////////////////////////////////////////////////////////////////////////////////
+void MapClass::applyPendingBuildingRemovals()
+{
+	for(auto & player : GameMode->players.getPool())
 	{
-		m_removedBuildings.emplace_back(removedBuilding_);
+		auto& pending = m_pendingRemovals[player->getIndex()];
+		if (pending.queue.empty())
+			continue;
 
-		for(auto & player : GameMode->players.getPool())
+		if (!pending.sorted)
+		{
+			const_a location = player->getLocation();
+			std::sort(pending.queue.begin(), pending.queue.end(),
+					[&location](RemovedBuilding const & lhs_, RemovedBuilding const & rhs_)
+					{
+						return lhs_.origin.distanceSquared(location) > rhs_.origin.distanceSquared(location);
+					}
+				);
+			pending.sorted = true;
+		}
+
+		std::size_t sent = 0;
+		while (sent < m_buildingRemovalsPerTick && !pending.queue.empty())
 		{
-			this->applyRemovedBuilding(*player, removedBuilding_);
+			// Removal may have been replaced by a larger one queued later, sending it would have no effect.
+			if (m_removedBuildings.contains(pending.queue.back()))
+			{
+				this->applyRemovedBuilding(*player, pending.queue.back());
+				++sent;
+			}
+			pending.queue.pop_back();
 		}
 	}
 }
@@ -187,6 +219,21 @@ void MapClass::whenPlayerConnects(Player& player_)
 	this->applyRemovedBuildings(player_);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////
+void MapClass::whenPlayerSpawns(Player& player_)
+{
+	m_pendingRemovals[player_.getIndex()].sorted = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+void MapClass::whenPlayerDisconnects(Player& player_, [[maybe_unused]] Player::DisconnectReason reason_)
+{
+	auto& pending = m_pendingRemovals[player_.getIndex()];
+	pending.queue.clear();
+	pending.queue.shrink_to_fit();
+	pending.sorted = false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 void MapClass::applyRemovedBuilding(Player& player_, RemovedBuilding const & building_)
 {
@@ -200,8 +247,9 @@ void MapClass::applyRemovedBuilding(Player& player_, RemovedBuilding const & bui
 ///////////////////////////////////////////////////////////////////////////////////////
 void MapClass::applyRemovedBuildings(Player& player_)
 {
-	for (auto const & building : m_removedBuildings)
-		this->applyRemovedBuilding(player_, building);
+	auto& pending = m_pendingRemovals[player_.getIndex()];
+	pending.queue = m_removedBuildings.getAll();
+	pending.sorted = false;
 }
 
 } // namespace agdk
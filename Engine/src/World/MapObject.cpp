@@ -1,6 +1,7 @@
 #include SAMPCPP_PCH
 
 #include <SAMPCpp/World/MapObject.hpp>
+#include <SAMPCpp/World/MaterialTable.hpp>
 #include <SAMPCpp/Server/Player.hpp>
 
 
@@ -40,8 +41,7 @@ void IMapObject::Text::apply(IMapObject & object_, std::size_t const materialInd
 IMapObject::IMapObject()
 	:
 	m_modelIndex{ -1 },
-	m_drawDistance{ cxDefaultDrawDistance },
-	m_inMotion{ false }
+	m_drawDistance{ cxDefaultDrawDistance }
 {
 
 }
@@ -56,40 +56,31 @@ void IMapObject::setModel(Int32 const modelIndex_)
 //////////////////////////////////////////////////////////////////////////
 void IMapObject::setMaterial(std::size_t const materialIndex_, Text const & textMaterial_)
 {
-	if (materialIndex_ <= 15)
-	{
-		if (m_materials.size() <= materialIndex_)
-			m_materials.resize(materialIndex_ + 1);
-
-		m_materials[materialIndex_] = std::make_unique<IMapObject::Text>(textMaterial_);
-
-		this->applyText(materialIndex_, textMaterial_);
-	}
-#ifdef _DEBUG
-	else {
-		assert(false);
-	}
-	// Assertion note:
-	// You've tried to set material with index > 15, but SAMP does not allow it. Fix your code.
-#endif
+	this->setMaterial(materialIndex_, MaterialTable::instance().intern(textMaterial_));
 }
 
 //////////////////////////////////////////////////////////////////////////
 void IMapObject::setMaterial(std::size_t const materialIndex_, Texture const & textureMaterial_)
 {
-	if (materialIndex_ <= 15)
+	this->setMaterial(materialIndex_, MaterialTable::instance().intern(textureMaterial_));
+}
+
+//////////////////////////////////////////////////////////////////////////
+void IMapObject::setMaterial(std::size_t const materialIndex_, MaterialHandle material_)
+{
+	if (materialIndex_ <= 15 && material_)
 	{
 		if (m_materials.size() <= materialIndex_)
 			m_materials.resize(materialIndex_ + 1);
 
-		m_materials[materialIndex_] = std::make_unique<IMapObject::Texture>(textureMaterial_);
+		m_materials[materialIndex_] = std::move(material_);
 
-		this->applyTexture(materialIndex_, textureMaterial_);
+		this->applyMaterial(materialIndex_, *m_materials[materialIndex_]);
 	}
 #ifdef _DEBUG
 	else {
 		// Assertion note:
-		// You've tried to set material with index > 15, but SAMP does not allow it. Fix your code.
+		// You've tried to set material with index > 15 (SAMP does not allow it) or an empty material. Fix your code.
 		assert(false);
 	}
 #endif
@@ -134,7 +125,31 @@ IMapObject::MaterialsContainer const& IMapObject::getMaterials() const
 //////////////////////////////////////////////////////////////////////////
 bool IMapObject::isInMotion() const
 {
-	return m_inMotion;
+	return m_motion && !m_motion->isFinishedAt(IUpdatable::Clock::now());
+}
+
+//////////////////////////////////////////////////////////////////////////
+void IMapObject::settleMotion()
+{
+	if (m_motion)
+	{
+		const_a now = IUpdatable::Clock::now();
+		this->syncLocation(m_motion->locationAt(now));
+		m_rotation = m_motion->rotationAt(now);
+		m_motion.reset();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+math::Vector3f IMapObject::getTrackedLocation() const
+{
+	return m_motion ? m_motion->locationAt(IUpdatable::Clock::now()) : m_storedLocation;
+}
+
+//////////////////////////////////////////////////////////////////////////
+math::Vector3f IMapObject::getTrackedRotation() const
+{
+	return m_motion ? m_motion->rotationAt(IUpdatable::Clock::now()) : m_rotation;
 }
 
 //////////////////////////////////////////////////////////////////////////
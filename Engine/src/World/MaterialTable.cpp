@@ -0,0 +1,135 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/World/MaterialTable.hpp>
+
+namespace samp_cpp
+{
+
+namespace
+{
+
+/// <summary>
+/// Mixes the value hash into the seed.
+/// </summary>
+template <typename T>
+void hashCombine(std::size_t & seed_, T const & value_)
+{
+	seed_ ^= std::hash<T>{}(value_) + 0x9e3779b9 + (seed_ << 6) + (seed_ >> 2);
+}
+
+/// <summary>
+/// Removes entries whose material is referenced only by the table.
+/// </summary>
+template <typename TMap>
+std::size_t eraseUnused(TMap & map_)
+{
+	std::size_t removed = 0;
+	for (auto it = map_.begin(); it != map_.end(); )
+	{
+		if (it->second.use_count() == 1)
+		{
+			it = map_.erase(it);
+			++removed;
+		}
+		else
+			++it;
+	}
+	return removed;
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////
+MaterialTable& MaterialTable::instance()
+{
+	static MaterialTable table;
+	return table;
+}
+
+///////////////////////////////////////////////////////////////////////////
+MaterialTable::MaterialHandle MaterialTable::intern(IMapObject::Text const & textMaterial_)
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	auto it = m_texts.find(textMaterial_);
+	if (it == m_texts.end())
+		it = m_texts.emplace(textMaterial_, std::make_shared<IMapObject::Text const>(textMaterial_)).first;
+	return it->second;
+}
+
+///////////////////////////////////////////////////////////////////////////
+MaterialTable::MaterialHandle MaterialTable::intern(IMapObject::Texture const & textureMaterial_)
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	auto it = m_textures.find(textureMaterial_);
+	if (it == m_textures.end())
+		it = m_textures.emplace(textureMaterial_, std::make_shared<IMapObject::Texture const>(textureMaterial_)).first;
+	return it->second;
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::size_t MaterialTable::purgeUnused()
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	return eraseUnused(m_texts) + eraseUnused(m_textures);
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::size_t MaterialTable::size() const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	return m_texts.size() + m_textures.size();
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::size_t MaterialTable::TextHash::operator()(IMapObject::Text const & material_) const
+{
+	std::size_t seed = 0;
+	hashCombine(seed, material_.text);
+	hashCombine(seed, material_.size);
+	hashCombine(seed, material_.font);
+	hashCombine(seed, material_.fontSize);
+	hashCombine(seed, material_.bold);
+	hashCombine(seed, material_.fontColor.toUint32());
+	hashCombine(seed, material_.backColor.toUint32());
+	hashCombine(seed, static_cast<int>(material_.textAlign));
+	return seed;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool MaterialTable::TextEqual::operator()(IMapObject::Text const & lhs_, IMapObject::Text const & rhs_) const
+{
+	return	lhs_.text					== rhs_.text &&
+			lhs_.size					== rhs_.size &&
+			lhs_.font					== rhs_.font &&
+			lhs_.fontSize				== rhs_.fontSize &&
+			lhs_.bold					== rhs_.bold &&
+			lhs_.fontColor.toUint32()	== rhs_.fontColor.toUint32() &&
+			lhs_.backColor.toUint32()	== rhs_.backColor.toUint32() &&
+			lhs_.textAlign				== rhs_.textAlign;
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::size_t MaterialTable::TextureHash::operator()(IMapObject::Texture const & material_) const
+{
+	std::size_t seed = 0;
+	hashCombine(seed, material_.modelIndex);
+	hashCombine(seed, material_.txdName);
+	hashCombine(seed, material_.textureName);
+	hashCombine(seed, material_.color.toUint32());
+	return seed;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool MaterialTable::TextureEqual::operator()(IMapObject::Texture const & lhs_, IMapObject::Texture const & rhs_) const
+{
+	return	lhs_.modelIndex			== rhs_.modelIndex &&
+			lhs_.txdName			== rhs_.txdName &&
+			lhs_.textureName		== rhs_.textureName &&
+			lhs_.color.toUint32()	== rhs_.color.toUint32();
+}
+
+}
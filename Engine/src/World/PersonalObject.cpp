@@ -117,6 +117,17 @@ bool PersonalObject::spawn([[maybe_unused]] Player const & player_)
 	{
 		m_handle = sampgdk_CreatePlayerObject(m_player.getIndex(), m_modelIndex, m_storedLocation.x, m_storedLocation.y, m_storedLocation.z,
 			m_rotation.x, m_rotation.y, m_rotation.z, m_drawDistance);
+
+		if (m_handle != InvalidHandle)
+		{
+			// Materials set before the object was spawned:
+			for (std::size_t i = 0; i < m_materials.size(); i++)
+			{
+				auto const &material = m_materials[i];
+				if (material)
+					this->applyMaterial(i, *material);
+			}
+		}
 	}
 	return m_handle != InvalidHandle;
 }
@@ -0,0 +1,51 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/World/PersonalObjectBatch.hpp>
+
+namespace samp_cpp
+{
+
+//////////////////////////////////////////////////////////////////////////
+std::size_t PersonalObjectBatch::add(Int32 modelIndex_, math::Vector3f const & location_, math::Vector3f const & rotation_, float drawDistance_)
+{
+	m_entries.push_back( Entry{ modelIndex_, location_, rotation_, drawDistance_ } );
+	return m_entries.size() - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool PersonalObjectBatch::setMaterial(std::size_t objectIndex_, std::size_t materialIndex_, Material material_)
+{
+	// SAMP does not allow material with index > 15.
+	if (objectIndex_ >= m_entries.size() || materialIndex_ >= IMapObject::MaxMaterialCount)
+		return false;
+
+	if (!m_materials.empty() && m_materials.back().objectIndex > objectIndex_)
+		m_materialsSorted = false;
+
+	m_materials.push_back( MaterialEntry{ objectIndex_, materialIndex_, std::move(material_) } );
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+std::vector<PersonalObjectBatch::MaterialEntry> const& PersonalObjectBatch::getMaterials() const
+{
+	if (!m_materialsSorted)
+	{
+		// Stable, so later material set for the same slot still wins.
+		std::stable_sort(m_materials.begin(), m_materials.end(),
+				[](MaterialEntry const & lhs_, MaterialEntry const & rhs_) { return lhs_.objectIndex < rhs_.objectIndex; }
+			);
+		m_materialsSorted = true;
+	}
+	return m_materials;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PersonalObjectBatch::clear()
+{
+	m_entries.clear();
+	m_materials.clear();
+	m_materialsSorted = true;
+}
+
+}
@@ -0,0 +1,96 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/World/Region.hpp>
+
+namespace samp_cpp
+{
+
+///////////////////////////////////////////////////////////////////////////
+Region::Region(Shape shape_, Int32 world_, Int32 interior_)
+	:
+	m_shape{ shape_ },
+	m_world{ world_ },
+	m_interior{ interior_ }
+{
+}
+
+///////////////////////////////////////////////////////////////////////////
+Region Region::box(math::Vector3f const & min_, math::Vector3f const & max_, Int32 world_, Int32 interior_)
+{
+	Region region{ Shape::Box, world_, interior_ };
+	region.m_min = { std::min(min_.x, max_.x), std::min(min_.y, max_.y), std::min(min_.z, max_.z) };
+	region.m_max = { std::max(min_.x, max_.x), std::max(min_.y, max_.y), std::max(min_.z, max_.z) };
+	return region;
+}
+
+///////////////////////////////////////////////////////////////////////////
+Region Region::sphere(math::Vector3f const & center_, float radius_, Int32 world_, Int32 interior_)
+{
+	Region region{ Shape::Sphere, world_, interior_ };
+	region.m_min		= center_ - math::Vector3f{ radius_, radius_, radius_ };
+	region.m_max		= center_ + math::Vector3f{ radius_, radius_, radius_ };
+	region.m_center		= center_;
+	region.m_radiusSq	= radius_ * radius_;
+	return region;
+}
+
+///////////////////////////////////////////////////////////////////////////
+Region Region::polygon(std::vector<math::Vector2f> points_, float minZ_, float maxZ_, Int32 world_, Int32 interior_)
+{
+	Region region{ Shape::Polygon, world_, interior_ };
+	region.m_min = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::min(minZ_, maxZ_) };
+	region.m_max = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::max(minZ_, maxZ_) };
+	for (auto const & point : points_)
+	{
+		region.m_min.x = std::min(region.m_min.x, point.x);
+		region.m_min.y = std::min(region.m_min.y, point.y);
+		region.m_max.x = std::max(region.m_max.x, point.x);
+		region.m_max.y = std::max(region.m_max.y, point.y);
+	}
+	region.m_points = std::move(points_);
+	return region;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool Region::contains(ActorPlacement const & placement_) const
+{
+	return	(m_world == Any || m_world == placement_.world) &&
+			(m_interior == Any || m_interior == placement_.interior) &&
+			this->contains(placement_.location);
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool Region::contains(math::Vector3f const & location_) const
+{
+	if (location_.x < m_min.x || location_.y < m_min.y || location_.z < m_min.z ||
+		location_.x > m_max.x || location_.y > m_max.y || location_.z > m_max.z)
+		return false;
+
+	switch(m_shape)
+	{
+	case Shape::Box:
+		return true;
+	case Shape::Sphere:
+		return m_center.distanceSquared(location_) <= m_radiusSq;
+	case Shape::Polygon:
+	{
+		if (m_points.size() < 3)
+			return false;
+
+		// Even-odd rule (ray cast towards +X).
+		bool inside = false;
+		for (std::size_t i = 0, j = m_points.size() - 1; i < m_points.size(); j = i++)
+		{
+			auto const & a = m_points[i];
+			auto const & b = m_points[j];
+			if ((a.y > location_.y) != (b.y > location_.y) &&
+				location_.x < (b.x - a.x) * (location_.y - a.y) / (b.y - a.y) + a.x)
+				inside = !inside;
+		}
+		return inside;
+	}
+	}
+	return false;
+}
+
+}
@@ -0,0 +1,171 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/World/RegionTriggers.hpp>
+#include <SAMPCpp/Server/PlayerPool.hpp>
+
+namespace samp_cpp
+{
+
+///////////////////////////////////////////////////////////////////////////
+RegionTriggers::RegionTriggers()
+	:
+	m_nextId{ Region::InvalidId + 1 },
+	m_playerRegions(PlayerPool::MaxSlots)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////
+Region::Id RegionTriggers::add(Region region_)
+{
+	const_a id = m_nextId++;
+	region_.m_id = id;
+
+	auto& region = m_regions.emplace(id, std::move(region_)).first->second;
+	this->forEachCellOf(region,
+			[id](std::vector<Region::Id> & cell_)
+			{
+				cell_.push_back(id);
+			}
+		);
+	return id;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool RegionTriggers::remove(Region::Id id_)
+{
+	auto it = m_regions.find(id_);
+	if (it == m_regions.end())
+		return false;
+
+	this->forEachCellOf(it->second,
+			[id_](std::vector<Region::Id> & cell_)
+			{
+				auto cellIt = std::find(cell_.begin(), cell_.end(), id_);
+				if (cellIt != cell_.end())
+				{
+					*cellIt = cell_.back();
+					cell_.pop_back();
+				}
+			}
+		);
+
+	for (auto & regions : m_playerRegions)
+	{
+		auto regionIt = std::lower_bound(regions.begin(), regions.end(), id_);
+		if (regionIt != regions.end() && *regionIt == id_)
+			regions.erase(regionIt);
+	}
+
+	m_regions.erase(it);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+Region const* RegionTriggers::get(Region::Id id_) const
+{
+	auto it = m_regions.find(id_);
+	return it != m_regions.end() ? &it->second : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool RegionTriggers::isPlayerInside(Player const & player_, Region::Id id_) const
+{
+	auto const & regions = this->getRegionsOf(player_);
+	return std::binary_search(regions.begin(), regions.end(), id_);
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::vector<Region::Id> const& RegionTriggers::getRegionsOf(Player const & player_) const
+{
+	return m_playerRegions[ static_cast<std::size_t>(player_.getIndex()) ];
+}
+
+///////////////////////////////////////////////////////////////////////////
+void RegionTriggers::update(PlayerPool const & players_)
+{
+	for (auto player : players_.getPool())
+	{
+		const_a index = static_cast<std::size_t>(player->getIndex());
+
+		m_inside.clear();
+		if (const_a location = players_.getIndexedLocation(index))
+		{
+			const_a cell = GridCells::cellOf(location->x, location->y, CellSize);
+			auto cellIt = m_cells.find( GridCells::packKey(cell.first, cell.second) );
+			const_a hasCellRegions = (cellIt != m_cells.end() && !cellIt->second.empty());
+
+			if (hasCellRegions || !m_largeRegions.empty())
+			{
+				// World and interior come from the state snapshot refreshed earlier in the Input phase,
+				// so this does not call natives unless a setter invalidated them this frame.
+				ActorPlacement const placement{ *location, player->getWorld(), player->getInterior() };
+				if (hasCellRegions)
+					this->collectContaining(cellIt->second, placement);
+				this->collectContaining(m_largeRegions, placement);
+				std::sort(m_inside.begin(), m_inside.end());
+			}
+		}
+
+		auto& previous = m_playerRegions[index];
+		if (previous == m_inside)
+			continue;
+
+		m_entered.clear();
+		m_left.clear();
+		std::set_difference(m_inside.begin(), m_inside.end(), previous.begin(), previous.end(), std::back_inserter(m_entered));
+		std::set_difference(previous.begin(), previous.end(), m_inside.begin(), m_inside.end(), std::back_inserter(m_left));
+		previous = m_inside;
+
+		// Handlers may remove regions, look them up every time.
+		for (auto id : m_left)
+		{
+			if (auto region = this->get(id))
+				onPlayerLeaveRegion.emit(*player, *region);
+		}
+		for (auto id : m_entered)
+		{
+			if (auto region = this->get(id))
+				onPlayerEnterRegion.emit(*player, *region);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////
+void RegionTriggers::whenPlayerDisconnects(Player const & player_)
+{
+	m_playerRegions[ static_cast<std::size_t>(player_.getIndex()) ].clear();
+}
+
+///////////////////////////////////////////////////////////////////////////
+void RegionTriggers::collectContaining(std::vector<Region::Id> const & regions_, ActorPlacement const & placement_)
+{
+	for (auto id : regions_)
+	{
+		if (m_regions.at(id).contains(placement_))
+			m_inside.push_back(id);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <typename TFunc>
+void RegionTriggers::forEachCellOf(Region const & region_, TFunc && func_)
+{
+	// Coordinates are clamped, so infinite or NaN bounds cannot overflow cell coordinates.
+	const_a minCell = GridCells::cellOf(region_.getBoundsMin().x, region_.getBoundsMin().y, CellSize);
+	const_a maxCell = GridCells::cellOf(region_.getBoundsMax().x, region_.getBoundsMax().y, CellSize);
+
+	const_a cellCount = GridCells::countCells(minCell, maxCell);
+	if (cellCount == 0 || cellCount > MaxRegionCells)
+	{
+		func_(m_largeRegions);
+		return;
+	}
+
+	for (Int64 x = minCell.first; x <= maxCell.first; ++x)
+	{
+		for (Int64 y = minCell.second; y <= maxCell.second; ++y)
+			func_(m_cells[ GridCells::packKey(x, y) ]);
+	}
+}
+
+}
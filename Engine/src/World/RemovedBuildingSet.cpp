@@ -0,0 +1,189 @@
+#include SAMPCPP_PCH
+
+#include <SAMPCpp/World/RemovedBuildingSet.hpp>
+#include <SAMPCpp/Core/Container/SpatialHashGrid.hpp>
+
+namespace samp_cpp
+{
+
+///////////////////////////////////////////////////////////////////////////
+bool RemovedBuildingSet::add(RemovedBuilding const & building_)
+{
+	if (m_exact.find(building_) != m_exact.end() || this->covers(building_))
+		return false;
+
+	if (building_.model == RemovedBuilding::AnyModel)
+	{
+		// Removal of every model can cover removals of any model.
+		for (auto & [model, buildings] : m_byModel)
+			this->dropCoveredBy(buildings, building_);
+	}
+	else
+	{
+		auto it = m_byModel.find(building_.model);
+		if (it != m_byModel.end())
+			this->dropCoveredBy(it->second, building_);
+	}
+
+	m_byModel[building_.model].push_back(building_);
+	m_exact.insert(building_);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool RemovedBuildingSet::covers(RemovedBuilding const & building_) const
+{
+	auto it = m_byModel.find(building_.model);
+	if (it != m_byModel.end() && anyCovers(it->second, building_))
+		return true;
+
+	if (building_.model != RemovedBuilding::AnyModel)
+	{
+		it = m_byModel.find(RemovedBuilding::AnyModel);
+		if (it != m_byModel.end() && anyCovers(it->second, building_))
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void RemovedBuildingSet::clear()
+{
+	m_exact.clear();
+	m_byModel.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::vector<RemovedBuilding> RemovedBuildingSet::getAll() const
+{
+	std::vector<RemovedBuilding> result;
+	result.reserve(m_exact.size());
+	this->forEach([&](RemovedBuilding const & building_) { result.push_back(building_); });
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::vector<RemovedBuilding> RemovedBuildingSet::coalesce(std::vector<RemovedBuilding> buildings_)
+{
+	// Covering removal is never smaller than the covered one.
+	std::sort(buildings_.begin(), buildings_.end(),
+			[](RemovedBuilding const & lhs_, RemovedBuilding const & rhs_) { return lhs_.radius.value > rhs_.radius.value; }
+		);
+
+	// Small removals are indexed in a grid, so only nearby ones are checked.
+	// Large removals would make the grid search huge areas, they are checked directly instead.
+	struct ModelIndex
+	{
+		SpatialHashGrid<std::size_t>	grid{ CoalesceCellSize };
+		float							gridMaxRadius = 0.f;
+		std::vector<std::size_t>		large;
+	};
+
+	std::vector<RemovedBuilding> result;
+	result.reserve(buildings_.size());
+
+	std::unordered_map<Int32, ModelIndex> indices;
+
+	const_a isCoveredBy = [&](ModelIndex const & index_, RemovedBuilding const & building_)
+		{
+			for (auto i : index_.large)
+			{
+				if (covers(result[i], building_))
+					return true;
+			}
+
+			const_a radius		= static_cast<float>(building_.radius.value);
+			const_a searchRange	= index_.gridMaxRadius - radius;
+			if (searchRange < 0.f)
+				return false;
+
+			bool covered = false;
+			index_.grid.forEachInRadius(building_.origin, searchRange,
+					[&](SpatialHashGrid<std::size_t>::Entry const & entry_) {
+						covered = covered || covers(result[entry_.value], building_);
+					}
+				);
+			return covered;
+		};
+
+	for (auto const & building : buildings_)
+	{
+		auto sameModel = indices.find(building.model);
+		if (sameModel != indices.end() && isCoveredBy(sameModel->second, building))
+			continue;
+
+		if (building.model != RemovedBuilding::AnyModel)
+		{
+			auto anyModel = indices.find(RemovedBuilding::AnyModel);
+			if (anyModel != indices.end() && isCoveredBy(anyModel->second, building))
+				continue;
+		}
+
+		auto& index = indices[building.model];
+		const_a radius = static_cast<float>(building.radius.value);
+		if (building.model == RemovedBuilding::AnyModel || radius > CoalesceLargeRadius)
+			index.large.push_back(result.size());
+		else
+		{
+			index.grid.insert(building.origin, result.size());
+			index.gridMaxRadius = std::max(index.gridMaxRadius, radius);
+		}
+		result.push_back(building);
+	}
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool RemovedBuildingSet::covers(RemovedBuilding const & covering_, RemovedBuilding const & covered_)
+{
+	if (covering_.model != RemovedBuilding::AnyModel && covering_.model != covered_.model)
+		return false;
+
+	const_a radiusDiff = covering_.radius.value - covered_.radius.value;
+	if (radiusDiff < 0)
+		return false;
+
+	// Covered sphere lies entirely inside the covering one.
+	return covering_.origin.distanceSquared(covered_.origin) <= radiusDiff * radiusDiff;
+}
+
+///////////////////////////////////////////////////////////////////////////
+std::size_t RemovedBuildingSet::Hash::operator()(RemovedBuilding const & building_) const
+{
+	std::size_t result = std::hash<Int32>{}(building_.model);
+
+	const_a combine = [&result](std::size_t value_) {
+			result ^= value_ + 0x9e3779b9 + (result << 6) + (result >> 2);
+		};
+	combine(std::hash<float>{}(building_.origin.x));
+	combine(std::hash<float>{}(building_.origin.y));
+	combine(std::hash<float>{}(building_.origin.z));
+	combine(std::hash<decltype(building_.radius.value)>{}(building_.radius.value));
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////
+bool RemovedBuildingSet::anyCovers(std::vector<RemovedBuilding> const & buildings_, RemovedBuilding const & building_)
+{
+	return std::any_of(buildings_.begin(), buildings_.end(),
+			[&building_](RemovedBuilding const & element_) { return covers(element_, building_); }
+		);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void RemovedBuildingSet::dropCoveredBy(std::vector<RemovedBuilding> & buildings_, RemovedBuilding const & building_)
+{
+	for (std::size_t i = 0; i < buildings_.size(); )
+	{
+		if (covers(building_, buildings_[i]))
+		{
+			m_exact.erase(buildings_[i]);
+			buildings_[i] = buildings_.back();
+			buildings_.pop_back();
+		}
+		else
+			++i;
+	}
+}
+
+}
@@ -10,6 +10,11 @@ namespace samp_cpp
 Scene::Scene()
 	:
 	m_insideMap{ false },
+	m_transforming{ false },
+	m_transformDirty{ false },
+	m_lazy{ false },
+	m_materialized{ false },
+	m_boundsDirty{ true },
 	m_autoOrigin{ true }
 {
 }
@@ -17,12 +22,14 @@ Scene::Scene()
 ///////////////////////////////////////////////////////////////////////////////////////
 GlobalObject& Scene::finalizeConstruction(ObjectPtrType< GlobalObject > const& globalObject_)
 {
-	m_globalObjects.push_back(globalObject_);
-	m_objects.push_back(globalObject_.get());
+	if (!m_globalObjects.insert(globalObject_))
+		return *globalObject_;
+	m_objects.insert(globalObject_.get());
 
 	this->applyNewObjectToOrigin(*globalObject_, m_objects.size());
+	m_boundsDirty = true;
 
-	if (m_insideMap)
+	if (m_materialized)
 		GameMode->streamer->whenObjectJoinsMap(*globalObject_);
 
 	return *globalObject_;
@@ -47,21 +54,59 @@ void Scene::cancelBuildingRemoval(RemovedBuilding const building_)
 ///////////////////////////////////////////////////////////////////////////////////////
 UniversalObject& Scene::finalizeConstruction(ObjectPtrType< UniversalObject > const& universalObject_)
 {
-	m_universalObjects.push_back(universalObject_);
-	m_objects.push_back(universalObject_.get());
+	if (!m_universalObjects.insert(universalObject_))
+		return *universalObject_;
+	m_objects.insert(universalObject_.get());
 
 	this->applyNewObjectToOrigin(*universalObject_, m_objects.size());
+	m_boundsDirty = true;
 
-	if (m_insideMap)
+	if (m_materialized)
 		GameMode->streamer->whenObjectJoinsMap(*universalObject_);
 
 	return *universalObject_;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
-bool Scene::contains(IMapObject & object_)
+bool Scene::remove(GlobalObject & globalObject_)
+{
+	if (!m_globalObjects.contains(globalObject_))
+		return false;
+
+	if (m_materialized)
+		GameMode->streamer->whenObjectLeavesMap(globalObject_);
+
+	// Keep the object alive until it is completely removed.
+	const_a removed = m_globalObjects.remove(globalObject_);
+	m_objects.remove(globalObject_);
+
+	this->applyRemovedObjectToOrigin(globalObject_, m_objects.size());
+	m_boundsDirty = true;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+bool Scene::remove(UniversalObject & universalObject_)
+{
+	if (!m_universalObjects.contains(universalObject_))
+		return false;
+
+	if (m_materialized)
+		GameMode->streamer->whenObjectLeavesMap(universalObject_);
+
+	// Keep the object alive until it is completely removed.
+	const_a removed = m_universalObjects.remove(universalObject_);
+	m_objects.remove(universalObject_);
+
+	this->applyRemovedObjectToOrigin(universalObject_, m_objects.size());
+	m_boundsDirty = true;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+bool Scene::contains(IMapObject const & object_) const
 {
-	return std::find(m_objects.begin(), m_objects.end(), &object_) != m_objects.end();
+	return m_objects.contains(object_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -75,10 +120,52 @@ void Scene::setOrigin(math::Vector3f const location_)
 void Scene::setLocation(math::Vector3f const location_)
 {
 	const_a delta = location_ - m_origin;
+	const_a standalone = !m_transforming;
+	if (standalone)
+		this->beginTransform();
+
 	for (auto object : m_objects)
 		object->move(delta);
 
 	m_origin = location_;
+	m_transformDirty = true;
+
+	if (standalone)
+		this->commitTransform();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+void Scene::beginTransform()
+{
+	m_transforming = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+void Scene::commitTransform()
+{
+	if (!m_transforming)
+		return;
+
+	m_transforming = false;
+	if (!m_transformDirty)
+		return;
+
+	m_transformDirty = false;
+	m_boundsDirty = true;
+	if (!m_materialized)
+		return;
+
+	std::vector<GlobalObject*> globalObjects;
+	globalObjects.reserve(m_globalObjects.size());
+	for (const_a &globalObject : m_globalObjects)
+		globalObjects.push_back(globalObject.get());
+
+	std::vector<UniversalObject*> universalObjects;
+	universalObjects.reserve(m_universalObjects.size());
+	for (const_a &universalObject : m_universalObjects)
+		universalObjects.push_back(universalObject.get());
+
+	GameMode->streamer->whenObjectsRelocated(globalObjects, universalObjects);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +174,78 @@ void Scene::move(math::Vector3f const delta_)
 	this->setLocation(m_origin + delta_);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////
+void Scene::setLazy(bool const lazy_)
+{
+	if (m_insideMap)
+		return;
+
+	m_lazy = lazy_;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+void Scene::materialize()
+{
+	if (!m_insideMap || m_materialized)
+		return;
+
+	m_materialized = true;
+	for (const_a &globalObject : m_globalObjects) {
+		GameMode->streamer->whenObjectJoinsMap(*globalObject);
+	}
+	for (const_a &universalObject : m_universalObjects) {
+		GameMode->streamer->whenObjectJoinsMap(*universalObject);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+void Scene::dematerialize()
+{
+	if (!m_materialized)
+		return;
+
+	m_materialized = false;
+	for(const_a &globalObject : m_globalObjects) {
+		GameMode->streamer->whenObjectLeavesMap(*globalObject);
+	}
+	for (const_a &universalObject : m_universalObjects) {
+		GameMode->streamer->whenObjectLeavesMap(*universalObject);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+Scene::Bounds Scene::getBounds() const
+{
+	if (!m_boundsDirty)
+		return m_bounds;
+
+	m_boundsDirty	= false;
+	m_bounds		= Bounds{};
+	if (m_objects.empty())
+		return m_bounds;
+
+	// Center of the axis-aligned box, radius reaching the farthest object.
+	math::Vector3f min = m_objects[0]->getLocation();
+	math::Vector3f max = min;
+	for (auto object : m_objects)
+	{
+		const_a location = object->getLocation();
+		min = { std::min(min.x, location.x), std::min(min.y, location.y), std::min(min.z, location.z) };
+		max = { std::max(max.x, location.x), std::max(max.y, location.y), std::max(max.z, location.z) };
+	}
+
+	m_bounds.center = min;
+	m_bounds.center += max;
+	m_bounds.center /= 2.f;
+
+	float radiusSq = 0.f;
+	for (auto object : m_objects)
+		radiusSq = std::max(radiusSq, object->getLocation().distanceSquared(m_bounds.center));
+	m_bounds.radius = std::sqrt(radiusSq);
+
+	return m_bounds;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 void Scene::setAutomaticOrigin(bool const autoOrigin_)
 {
@@ -112,24 +271,19 @@ math::Vector3f Scene::getOrigin() const
 void Scene::whenSceneIsAddedToMap()
 {
 	m_insideMap = true;
-	for (const_a &globalObject : m_globalObjects) {
-		GameMode->streamer->whenObjectJoinsMap(*globalObject);
-	}
-	for (const_a &universalObject : m_universalObjects) {
-		GameMode->streamer->whenObjectJoinsMap(*universalObject);
-	}
+	if (m_lazy)
+		GameMode->streamer->whenLazySceneJoinsMap(*this);
+	else
+		this->materialize();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
 void Scene::whenSceneIsRemovedFromMap()
 {
+	if (m_lazy)
+		GameMode->streamer->whenLazySceneLeavesMap(*this);
+	this->dematerialize();
 	m_insideMap = false;
-	for(const_a &globalObject : m_globalObjects) {
-		GameMode->streamer->whenObjectLeavesMap(*globalObject);
-	}
-	for (const_a &universalObject : m_universalObjects) {
-		GameMode->streamer->whenObjectLeavesMap(*universalObject);
-	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -151,4 +305,21 @@ void Scene::applyNewObjectToOrigin(IMapObject const & object_, std::size_t newOb
 	m_origin /= static_cast<float>( newObjectsCount_ );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////
+void Scene::applyRemovedObjectToOrigin(IMapObject const & object_, std::size_t newObjectsCount_)
+{
+	if (!m_autoOrigin)
+		return;
+
+	if (newObjectsCount_ == 0)
+	{
+		m_origin.set(0, 0, 0);
+		return;
+	}
+
+	m_origin *= static_cast<float>( newObjectsCount_ + 1 );
+	m_origin -= object_.getLocation();
+	m_origin /= static_cast<float>( newObjectsCount_ );
+}
+
 } // namespace agdk
\ No newline at end of file
@@ -68,6 +68,23 @@ void Chunk::intercept(UniquePtr<PersonalObjectWrapper>&& personalObject_)
 #endif
 }
 
+//////////////////////////////////////////////////////////////////////////////
+void Chunk::intercept(ActorContainer<PersonalObjectWrapper> && personalObjects_)
+{
+	m_personalObjects.reserve(m_personalObjects.size() + personalObjects_.size());
+	for (auto & personalObject : personalObjects_)
+	{
+		personalObject->setChunk(*this);
+		m_personalObjects.push_back(std::move(personalObject));
+	}
+	personalObjects_.clear();
+
+#ifdef SAMP_EDGENGINE_DEBUG
+	if constexpr (DebugConfig_VisualizeStreamerWithGangZones)
+		this->GZThingIntercepted();
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////////
 void Chunk::intercept(UniquePtr<CheckpointWrapper>&& checkpoint_)
 {
@@ -6,6 +6,7 @@
 #include <SAMPCpp/World/GlobalObject.hpp>
 #include <SAMPCpp/World/PersonalObject.hpp>
 #include <SAMPCpp/World/UniversalObject.hpp>
+#include <SAMPCpp/World/Scene.hpp>
 
 // Wrappers types:
 #include <SAMPCpp/World/Streamer/GlobalObjectWrapper.hpp>
@@ -26,7 +27,7 @@ namespace samp_cpp::default_streamer
 Streamer::Streamer()
 	: m_worldGrid{ {} }
 {
-	Server->onServerUpdate += { *this, &Streamer::update };
+	Server->pipeline[FramePhase::Streaming] += { *this, &Streamer::update };
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +64,9 @@ void Streamer::whenObjectJoinsMap(GlobalObject& globalObject_)
 {
 	auto& chunk = this->selectChunk(globalObject_.getLocation());
 	chunk.intercept( std::make_unique<GlobalObjectWrapper>(globalObject_) );
+
+	if (globalObject_.isInMotion())
+		this->whenObjectStartsMoving(globalObject_);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,11 +76,46 @@ void Streamer::whenObjectJoinsMap(PersonalObject& personalObject_)
 	chunk.intercept( std::make_unique<PersonalObjectWrapper>(personalObject_) );
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::whenObjectsJoinMap(Player & owner_, std::vector<PersonalObject*> const & personalObjects_)
+{
+	if (personalObjects_.empty())
+		return;
+
+	// Bin wrappers by chunk first, so that every chunk grows only once.
+	std::unordered_map< Chunk*, Chunk::ActorContainer<PersonalObjectWrapper> > bins;
+	Chunk* lastChunk = nullptr;
+	Chunk::ActorContainer<PersonalObjectWrapper>* lastBin = nullptr;
+	for (auto personalObject : personalObjects_)
+	{
+		auto& chunk = this->selectChunk(personalObject->getLocation());
+		if (&chunk != lastChunk)
+		{
+			lastChunk	= &chunk;
+			lastBin		= &bins[&chunk];
+		}
+		lastBin->push_back( std::make_unique<PersonalObjectWrapper>(*personalObject) );
+	}
+
+	for (auto & [chunk, wrappers] : bins)
+		chunk->intercept(std::move(wrappers));
+
+	// Evaluate visibility of the owner once, for every new object.
+	if (owner_.getPlacementTracker())
+	{
+		const_a placement = getWrapper(owner_).getLastPlacement();
+		this->whenPlayerPlacementChanges(owner_, placement, placement);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::whenObjectJoinsMap(UniversalObject& universalObject_)
 {
 	auto& chunk = this->selectChunk(universalObject_.getLocation());
 	chunk.intercept( std::make_unique<UniversalObjectWrapper>(universalObject_) );
+
+	if (universalObject_.isInMotion())
+		this->whenObjectStartsMoving(universalObject_);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,7 +188,11 @@ void Streamer::whenStaticVehicleLeavesMap(StaticVehicle& staticVehicle_)
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::whenObjectLeavesMap(GlobalObject& globalObject_)
 {
+	m_movingGlobalObjects.erase(&globalObject_);
+
 	auto& wrapper = getWrapper(globalObject_);
+	// Object might have moved since its chunk was selected.
+	const_a location = wrapper.getLastPlacement().location;
 	if (const_a chunk = wrapper.getChunk())
 	{
 		// Release the stored wrapper.
@@ -159,7 +202,7 @@ void Streamer::whenObjectLeavesMap(GlobalObject& globalObject_)
 
 	// Remove the chunk if unused:
 	// Note: it is crucial to avoid wasting performance and memory.
-	this->checkIfUnusedAndRemove(globalObject_.getLocation());
+	this->checkIfUnusedAndRemove(location);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,7 +224,11 @@ void Streamer::whenObjectLeavesMap(PersonalObject& personalObject_)
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::whenObjectLeavesMap(UniversalObject& universalObject_)
 {
+	m_movingUniversalObjects.erase(&universalObject_);
+
 	auto& wrapper = getWrapper(universalObject_);
+	// Object might have moved since its chunk was selected.
+	const_a location = wrapper.getLastPlacement().location;
 
 	if (const_a chunk = wrapper.getChunk())
 	{
@@ -192,17 +239,44 @@ void Streamer::whenObjectLeavesMap(UniversalObject& universalObject_)
 
 	// Remove the chunk if unused:
 	// Note: it is crucial to avoid wasting performance and memory.
-	this->checkIfUnusedAndRemove(universalObject_.getLocation());
+	this->checkIfUnusedAndRemove(location);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::whenCheckpointLeavesMap(Checkpoint& checkpoint_)
 {
+	// Checkpoints do not move between chunks, so the one selected on join still holds the wrapper.
+	const_a location	= checkpoint_.getLocation();
+	const_a chunk		= this->isOutsideGridBoundaries(location) ? &m_entireWorld : m_worldGrid.get(location);
+	if (chunk)
+	{
+		const_a& wrappers = chunk->getCheckpoints();
+		const_a it = std::find_if(wrappers.begin(), wrappers.end(),
+				[&checkpoint_](auto const& wrapper_) { return wrapper_->getCheckpoint() == &checkpoint_; }
+			);
+		if (it != wrappers.end())
+			auto unused = chunk->release(checkpoint_);
+	}
+
+	this->checkIfUnusedAndRemove(location);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::whenRaceCheckpointLeavesMap(RaceCheckpoint& raceCheckpoint_)
 {
+	const_a location	= raceCheckpoint_.getLocation();
+	const_a chunk		= this->isOutsideGridBoundaries(location) ? &m_entireWorld : m_worldGrid.get(location);
+	if (chunk)
+	{
+		const_a& wrappers = chunk->getRaceCheckpoints();
+		const_a it = std::find_if(wrappers.begin(), wrappers.end(),
+				[&raceCheckpoint_](auto const& wrapper_) { return wrapper_->getCheckpoint() == &raceCheckpoint_; }
+			);
+		if (it != wrappers.end())
+			auto unused = chunk->release(raceCheckpoint_);
+	}
+
+	this->checkIfUnusedAndRemove(location);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,6 +472,114 @@ void Streamer::whenObjectPlacementChanges(PersonalObject & personalObject_, Acto
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::whenObjectsRelocated(std::vector<GlobalObject*> const& globalObjects_, std::vector<UniversalObject*> const& universalObjects_)
+{
+	if (globalObjects_.empty() && universalObjects_.empty())
+		return;
+
+	// Bounds of the affected area (both previous and current locations).
+	math::Vector3f boundsMin{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+	math::Vector3f boundsMax{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+	const_a extendBounds = [&](math::Vector3f const & location_)
+		{
+			boundsMin = { std::min(boundsMin.x, location_.x), std::min(boundsMin.y, location_.y), std::min(boundsMin.z, location_.z) };
+			boundsMax = { std::max(boundsMax.x, location_.x), std::max(boundsMax.y, location_.y), std::max(boundsMax.z, location_.z) };
+		};
+
+	// Move every wrapper to its new chunk without recalculating visibility yet.
+	std::vector<GlobalObjectWrapper*> globalWrappers;
+	globalWrappers.reserve(globalObjects_.size());
+	for (auto globalObject : globalObjects_)
+	{
+		auto& wrapper = getWrapper(*globalObject);
+		const_a previous	= wrapper.getLastPlacement();
+		const_a current		= globalObject->getPlacement();
+		wrapper.resetPlacement(current);
+
+		auto& prevChunk = this->selectChunk(previous.location);
+		auto& currChunk = this->selectChunk(current.location);
+		if (&prevChunk != &currChunk)
+		{
+			currChunk.intercept(prevChunk.release(*globalObject));
+			this->checkIfUnusedAndRemove(previous.location);
+		}
+		extendBounds(previous.location);
+		extendBounds(current.location);
+		globalWrappers.push_back(&wrapper);
+	}
+
+	for (auto universalObject : universalObjects_)
+	{
+		auto& wrapper = getWrapper(*universalObject);
+		const_a previous	= wrapper.getLastPlacement();
+		const_a current		= universalObject->getPlacement();
+		wrapper.resetPlacement(current);
+
+		auto& prevChunk = this->selectChunk(previous.location);
+		auto& currChunk = this->selectChunk(current.location);
+		if (&prevChunk != &currChunk)
+		{
+			currChunk.intercept(prevChunk.release(*universalObject));
+			this->checkIfUnusedAndRemove(previous.location);
+		}
+		extendBounds(previous.location);
+		extendBounds(current.location);
+	}
+
+	// Collect players that can see any part of the affected area.
+	const_a range = static_cast<float>(StreamerSettings.VisibilityDistance.value);
+	std::vector<Player*> players;
+	for (auto player : GameMode->players.getPool())
+	{
+		if (!player || !player->getPlacementTracker())
+			continue;
+
+		const_a location = getWrapper(*player).getLastPlacement().location;
+		if (location.x >= boundsMin.x - range && location.x <= boundsMax.x + range &&
+			location.y >= boundsMin.y - range && location.y <= boundsMax.y + range &&
+			location.z >= boundsMin.z - range && location.z <= boundsMax.z + range)
+		{
+			players.push_back(player);
+		}
+	}
+
+	// Global objects: count players in visibility zone, only nearby players can be counted.
+	for (auto wrapper : globalWrappers)
+	{
+		Int16 visibilityIndex = 0;
+		for (auto player : players)
+		{
+			if (wrapper->isPlayerInVisibilityZone(getWrapper(*player).getLastPlacement()))
+				visibilityIndex++;
+		}
+		wrapper->setVisibilityIndex(visibilityIndex);
+		wrapper->applyVisibility();
+	}
+
+	// Per-player objects: re-evaluate every affected player once.
+	if (!universalObjects_.empty())
+	{
+		for (auto player : players)
+		{
+			const_a placement = getWrapper(*player).getLastPlacement();
+			this->whenPlayerPlacementChanges(*player, placement, placement);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::whenLazySceneJoinsMap(Scene & scene_)
+{
+	m_lazyScenes.emplace(&scene_, IUpdatable::TimePoint{});
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::whenLazySceneLeavesMap(Scene & scene_)
+{
+	m_lazyScenes.erase(&scene_);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 std::vector< Chunk* > Streamer::getChunksInRadiusFrom(math::Vector3f const& location_, math::Meters const radius_)
 {
@@ -493,6 +675,73 @@ void Streamer::update(double deltaTime_, IUpdatable::TimePoint frameTime_)
 		for (auto vehicle : GameMode->map.getStaticVehicles()) {
 			vehicle->sendPlacementUpdate();
 		}
+
+		this->updateMovingObjects();
+
+		if (m_nextLazySceneCheck < frameTime_)
+		{
+			m_nextLazySceneCheck = frameTime_ + StreamerSettings.LazySceneCheckInterval;
+			this->updateLazyScenes(frameTime_);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::whenObjectStartsMoving(GlobalObject & globalObject_)
+{
+	m_movingGlobalObjects.insert(&globalObject_);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::whenObjectStartsMoving(UniversalObject & universalObject_)
+{
+	m_movingUniversalObjects.insert(&universalObject_);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::updateMovingObjects()
+{
+	// Placement is interpolated on the server side, so this does not call any natives
+	// unless the object crosses the significant displacement distance.
+	for (auto it = m_movingGlobalObjects.begin(); it != m_movingGlobalObjects.end(); )
+	{
+		auto object = *it;
+		object->sendPlacementUpdate();
+		if (!object->isInMotion())
+			it = m_movingGlobalObjects.erase(it);
+		else
+			++it;
+	}
+
+	for (auto it = m_movingUniversalObjects.begin(); it != m_movingUniversalObjects.end(); )
+	{
+		auto object = *it;
+		object->sendPlacementUpdate();
+		if (!object->isInMotion())
+			it = m_movingUniversalObjects.erase(it);
+		else
+			++it;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void Streamer::updateLazyScenes(IUpdatable::TimePoint frameTime_)
+{
+	const_a range = StreamerSettings.VisibilityDistance.value + StreamerSettings.LazySceneMargin.value;
+	for (auto & [scene, lastVisit] : m_lazyScenes)
+	{
+		// Uses player locations cached in the Input phase, does not call any natives.
+		const_a bounds = scene->getBounds();
+		if (GameMode->players.findNearest(bounds.center, math::Meters{ bounds.radius + range }))
+		{
+			lastVisit = frameTime_;
+			if (!scene->isMaterialized())
+				scene->materialize();
+		}
+		else if (scene->isMaterialized() && frameTime_ - lastVisit >= StreamerSettings.LazySceneIdleTime)
+		{
+			scene->dematerialize();
+		}
 	}
 }
 
@@ -545,6 +794,16 @@ void Streamer::checkIfUnusedAndRemove(math::Vector3f const& location_)
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::streamNearestCheckpointForPlayer(Player& player_)
 {
+	// Player's own set replaces checkpoints placed on the map.
+	if (!player_.checkpoints.isEmpty())
+	{
+		const_a selected = player_.checkpoints.select(player_.getLocation(), static_cast<float>(StreamerSettings.VisibilityDistance.value),
+				player_.getWorld(), player_.getInterior());
+		if (selected && *selected != player_.getLastCheckpoint())
+			player_.setCheckpoint(*selected);
+		return;
+	}
+
 	auto chunksInRadius = this->getChunksInRadiusFrom(player_.getLocation(), StreamerSettings.VisibilityDistance);
 
 	std::vector<Checkpoint*> checkpoints;
@@ -588,6 +847,16 @@ void Streamer::streamNearestCheckpointForPlayer(Player& player_)
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void Streamer::streamNearestRaceCheckpointForPlayer(Player& player_)
 {
+	// Player's own set replaces checkpoints placed on the map.
+	if (!player_.raceCheckpoints.isEmpty())
+	{
+		const_a selected = player_.raceCheckpoints.select(player_.getLocation(), static_cast<float>(StreamerSettings.VisibilityDistance.value),
+				player_.getWorld(), player_.getInterior());
+		if (selected && *selected != player_.getLastRaceCheckpoint())
+			player_.setRaceCheckpoint(*selected);
+		return;
+	}
+
 	auto chunksInRadius = this->getChunksInRadiusFrom(player_.getLocation(), StreamerSettings.VisibilityDistance);
 
 	std::vector<RaceCheckpoint*> checkpoints;
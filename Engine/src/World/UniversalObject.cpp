@@ -5,6 +5,7 @@
 
 // Other includes:
 #include <SAMPCpp/Server/Player.hpp>
+#include <SAMPCpp/Server/GameMode.hpp>
 
 namespace samp_cpp
 {
@@ -12,10 +13,11 @@ namespace samp_cpp
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 UniversalObject::~UniversalObject()
 {
-	for (auto const & sP : m_playerHandles)
-	{
-		sampgdk_DestroyPlayerObject(sP.first->getIndex(), sP.second);
-	}
+	m_playerHandles.forEach(
+		[](std::size_t playerIndex_, Int32 handle_)
+		{
+			sampgdk_DestroyPlayerObject(static_cast<Int32>( playerIndex_ ), handle_);
+		});
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -27,87 +29,138 @@ void UniversalObject::setModel(Int32 const modelIndex_)
 //////////////////////////////////////////////////////////////////////////
 void UniversalObject::setLocation(math::Vector3f const & location_)
 {
+	if (m_motion)
+		this->stopMoving();
+
 	PerPlayerObject::setLocation(location_);
 
-	for (auto const & playerHandle : m_playerHandles)
-	{
-		sampgdk_SetPlayerObjectPos(static_cast<Int32>( playerHandle.first->getIndex() ), playerHandle.second, location_.x, location_.y, location_.z);
-	}
+	m_playerHandles.forEach(
+		[&location_](std::size_t playerIndex_, Int32 handle_)
+		{
+			sampgdk_SetPlayerObjectPos(static_cast<Int32>( playerIndex_ ), handle_, location_.x, location_.y, location_.z);
+		});
 }
 
 //////////////////////////////////////////////////////////////////////////
 void UniversalObject::setRotation(math::Vector3f const & rotationAxes_)
 {
+	if (m_motion)
+		this->stopMoving();
+
 	IMapObject::setRotation(rotationAxes_);
 
-	for (auto const & playerHandle : m_playerHandles)
+	m_playerHandles.forEach(
+		[this](std::size_t playerIndex_, Int32 handle_)
+		{
+			sampgdk_SetPlayerObjectRot(static_cast<Int32>( playerIndex_ ), handle_, m_rotation.x, m_rotation.y, m_rotation.z);
+		});
+}
+
+//////////////////////////////////////////////////////////////////////////
+void UniversalObject::moveTo(math::Vector3f const & targetLocation_, float const speed_, std::optional<math::Vector3f> const & targetRotation_)
+{
+	this->settleMotion();
+	m_motion = ObjectMotion::begin(m_storedLocation, m_rotation, targetLocation_, targetRotation_, speed_, IUpdatable::Clock::now());
+
+	m_playerHandles.forEach(
+		[this](std::size_t playerIndex_, Int32 handle_)
+		{
+			this->applyMotion(playerIndex_, handle_);
+		});
+
+	// Streamer keeps the placement up to date while the object moves.
+	if (m_placementTracker)
 	{
-		sampgdk_SetPlayerObjectRot(static_cast<Int32>( playerHandle.first->getIndex() ), playerHandle.second, m_rotation.x, m_rotation.y, m_rotation.z);
+		this->sendPlacementUpdate();
+		GameMode->streamer->whenObjectStartsMoving(*this);
 	}
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void UniversalObject::applyText(std::size_t const materialIndex_, Text const & textMaterial_, const Player * player_)
+//////////////////////////////////////////////////////////////////////////
+void UniversalObject::stopMoving()
 {
-	if (player_)
+	if (!m_motion)
+		return;
+
+	const_a wasMoving = this->isInMotion();
+	this->settleMotion();
+
+	if (wasMoving)
 	{
-		auto const it = std::find_if(m_playerHandles.begin(), m_playerHandles.end(),
-			[player_](std::pair<Player const*, Int32> const & pair_)
+		// Keep clients in sync with the tracked transform.
+		m_playerHandles.forEach(
+			[this](std::size_t playerIndex_, Int32 handle_)
 			{
-				return pair_.first == player_;
+				const_a playerIndex = static_cast<Int32>( playerIndex_ );
+				sampgdk_StopPlayerObject(playerIndex, handle_);
+				sampgdk_SetPlayerObjectPos(playerIndex, handle_, m_storedLocation.x, m_storedLocation.y, m_storedLocation.z);
+				sampgdk_SetPlayerObjectRot(playerIndex, handle_, m_rotation.x, m_rotation.y, m_rotation.z);
 			});
+	}
+
+	this->sendPlacementUpdate();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void UniversalObject::applyMotion(std::size_t playerIndex_, Int32 handle_) const
+{
+	const_a& motion		= *m_motion;
+	const_a rotation	= motion.targetRotation.value_or(math::Vector3f{ cxKeepMotionRotation, cxKeepMotionRotation, cxKeepMotionRotation });
+
+	sampgdk_MovePlayerObject(static_cast<Int32>( playerIndex_ ), handle_, motion.targetLocation.x, motion.targetLocation.y, motion.targetLocation.z, motion.speed,
+		rotation.x, rotation.y, rotation.z);
+}
 
-		if (it != m_playerHandles.end())
+//////////////////////////////////////////////////////////////////////////
+math::Vector3f UniversalObject::getLocation() const
+{
+	return this->getTrackedLocation();
+}
+
+//////////////////////////////////////////////////////////////////////////
+math::Vector3f UniversalObject::getRotation() const
+{
+	return this->getTrackedRotation();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void UniversalObject::applyText(std::size_t const materialIndex_, Text const & textMaterial_, const Player * player_)
+{
+	auto const apply = [&](std::size_t playerIndex_, Int32 handle_)
 		{
-			sampgdk_SetPlayerObjectMaterialText( static_cast<Int32>( it->first->getIndex() ), it->second,
+			sampgdk_SetPlayerObjectMaterialText( static_cast<Int32>( playerIndex_ ), handle_,
 				textMaterial_.text.c_str(), materialIndex_, textMaterial_.size,
 				textMaterial_.font.c_str(), textMaterial_.fontSize, textMaterial_.bold,
 				textMaterial_.fontColor.toARGB().toInt32(), textMaterial_.backColor.toARGB().toInt32(),
 				static_cast<Int32>(textMaterial_.textAlign)
 			);
-		}
-	}
-	else
+		};
+
+	if (player_)
 	{
-		for (auto const & sP : m_playerHandles)
-		{
-			sampgdk_SetPlayerObjectMaterialText( static_cast<Int32>( sP.first->getIndex() ), sP.second,
-				textMaterial_.text.c_str(), materialIndex_, textMaterial_.size,
-				textMaterial_.font.c_str(), textMaterial_.fontSize, textMaterial_.bold,
-				textMaterial_.fontColor.toARGB().toInt32(), textMaterial_.backColor.toARGB().toInt32(),
-				static_cast<Int32>(textMaterial_.textAlign)
-			);
-		}
+		if (const_a handle = this->findHandleForPlayer(*player_))
+			apply(static_cast<std::size_t>( player_->getIndex() ), *handle);
 	}
-	
+	else
+		m_playerHandles.forEach(apply);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void UniversalObject::applyTexture(std::size_t const materialIndex_, Texture const & textureMaterial_, const Player * player_)
 {
-	if (player_ != nullptr)
-	{
-		auto const it = std::find_if(m_playerHandles.begin(), m_playerHandles.end(),
-			[player_](std::pair<Player const*, Int32> const & pair_)
-			{
-				return pair_.first == player_;
-			});
-
-		if (it != m_playerHandles.end())
+	auto const apply = [&](std::size_t playerIndex_, Int32 handle_)
 		{
-			sampgdk_SetPlayerObjectMaterial(static_cast<Int32>( it->first->getIndex() ), it->second, materialIndex_, textureMaterial_.modelIndex,
+			sampgdk_SetPlayerObjectMaterial(static_cast<Int32>( playerIndex_ ), handle_, materialIndex_, textureMaterial_.modelIndex,
 				textureMaterial_.txdName.c_str(), textureMaterial_.textureName.c_str(), textureMaterial_.color.toARGB().toInt32());
-		}
+		};
 
-	}
-	else
+	if (player_ != nullptr)
 	{
-		for (auto const & sP : m_playerHandles)
-		{
-			sampgdk_SetPlayerObjectMaterial(static_cast<Int32>( sP.first->getIndex() ), sP.second, materialIndex_, textureMaterial_.modelIndex,
-				textureMaterial_.txdName.c_str(), textureMaterial_.textureName.c_str(), textureMaterial_.color.toARGB().toInt32());
-		}
+		if (const_a handle = this->findHandleForPlayer(*player_))
+			apply(static_cast<std::size_t>( player_->getIndex() ), *handle);
 	}
+	else
+		m_playerHandles.forEach(apply);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -117,56 +170,49 @@ math::Meters UniversalObject::getDistanceSquaredTo(Player const & player_) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
-math::Vector3f UniversalObject::getLocationFor(Player const & player_) const
+math::Vector3f UniversalObject::getLocationFor([[maybe_unused]] Player const & player_) const
 {
-	for (auto const & playerHandle : m_playerHandles)
-	{
-		if (playerHandle.first == &player_)
-		{
-			math::Vector3f location;
-			sampgdk_GetPlayerObjectPos(static_cast<Int32>( playerHandle.first->getIndex() ), playerHandle.second, &location.x, &location.y, &location.z);
-			return location;
-		}
-	}
-	return m_storedLocation;
+	// Every player sees the same transform, tracked on the server side.
+	return this->getLocation();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
-math::Vector3f UniversalObject::getRotationFor(Player const & player_) const
+math::Vector3f UniversalObject::getRotationFor([[maybe_unused]] Player const & player_) const
 {
-	for (auto const & playerHandle : m_playerHandles)
-	{
-		if (playerHandle.first == &player_)
-		{
-			math::Vector3f rotation;
-			sampgdk_GetPlayerObjectRot(static_cast<Int32>( playerHandle.first->getIndex() ), playerHandle.second, &rotation.x, &rotation.y, &rotation.z);
-			return rotation;
-		}
-	}
-	return m_rotation;
+	return this->getRotation();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool UniversalObject::spawn(Player const & player_)
+bool UniversalObject::isSpawnedFor(Player const & player_) const
 {
-	auto const it = std::find_if(m_playerHandles.begin(), m_playerHandles.end(),
-		[&player_](std::pair<Player const*, Int32> const & pair_)
-		{
-			return pair_.first == &player_;
-		});
+	return m_playerHandles.contains( static_cast<std::size_t>( player_.getIndex() ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+std::optional<Int32> UniversalObject::findHandleForPlayer(Player const & player_) const
+{
+	return m_playerHandles.find( static_cast<std::size_t>( player_.getIndex() ) );
+}
 
-	if (it == m_playerHandles.end())
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UniversalObject::spawn(Player const & player_)
+{
+	const_a playerIndex = static_cast<std::size_t>( player_.getIndex() );
+	if (!m_playerHandles.contains(playerIndex))
 	{
-		Int32 handle = sampgdk_CreatePlayerObject(static_cast<Int32>( player_.getIndex() ), m_modelIndex, m_storedLocation.x, m_storedLocation.y, m_storedLocation.z,
-			m_rotation.x, m_rotation.y, m_rotation.z, m_drawDistance);
+		// Object in motion is created in its current (in-flight) transform and continues the motion.
+		const_a location = this->getLocation();
+		const_a rotation = this->getRotation();
+		Int32 handle = sampgdk_CreatePlayerObject(static_cast<Int32>( player_.getIndex() ), m_modelIndex, location.x, location.y, location.z,
+			rotation.x, rotation.y, rotation.z, m_drawDistance);
 		if (handle != InvalidHandle) {
 
-			m_playerHandles.emplace_back(&player_, handle);
+			m_playerHandles.insert(playerIndex, handle);
+
+			if (this->isInMotion())
+				this->applyMotion(playerIndex, handle);
 
-			// PERFORMANCE TODO: could get optimized:
-			// "applyMaterial" needs to find specified handle in vector.
-			// We have already this handle in this piece of code: `handle`.
-			// We could pass it and get better performance.
+			// Note: "applyMaterial" looks the handle up in constant time.
 			for (std::size_t i = 0; i < m_materials.size(); i++)
 			{
 				auto const &material = m_materials[i];
@@ -183,15 +229,10 @@ bool UniversalObject::spawn(Player const & player_)
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void UniversalObject::despawn(Player const & player_)
 {
-	auto it = std::find_if(m_playerHandles.begin(), m_playerHandles.end(),
-		[&player_](auto const & pair_) { return pair_.first == &player_; });
-	if (it != m_playerHandles.end())
+	if (const_a handle = m_playerHandles.remove( static_cast<std::size_t>( player_.getIndex() ) ))
 	{
-		sampgdk_DestroyPlayerObject(static_cast<Int32>( player_.getIndex() ), it->second);
-		m_playerHandles.erase(it);
+		sampgdk_DestroyPlayerObject(static_cast<Int32>( player_.getIndex() ), *handle);
 	}
 }
 
 } // namespace agdk
-
-
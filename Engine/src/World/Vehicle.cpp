@@ -336,6 +336,8 @@ bool Vehicle::spawn()
 		// TODO: verify if this works ^^^.
 		if (m_handle != InvalidHandle)
 		{
+			GameMode->map.whenVehicleSpawns(*this);
+
 			this->setInterior(m_interior);
 			this->setWorld(m_world);
 			return true;
@@ -367,6 +369,7 @@ void Vehicle::despawn()
 			m_passengers[i] = nullptr;
 		}
 		// EDGE_LOG_DEBUG(Info, "Despawning vehicle with handle {0}", m_handle);
+		GameMode->map.whenVehicleDespawns(*this);
 		sampgdk_DestroyVehicle(m_handle);
 	}
 	m_handle = InvalidHandle;
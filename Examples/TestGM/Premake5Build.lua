@@ -4,7 +4,7 @@ else
 	project "TestGM"
 		kind "SharedLib"
 		language "C++"
-		cppdialect "C++17"
+		cppdialect (edge.cppDialect)
 		location (path.join(repoRoot, "Build/Examples/%{prj.name}"))
 		targetdir (path.join(repoRoot, "Bin/%{cfg.platform}/%{cfg.buildcfg}/Examples"))
 
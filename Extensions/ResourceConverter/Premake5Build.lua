@@ -1,7 +1,7 @@
 project "Ext_ResourceConverter"
 	kind "ConsoleApp"
 	language "C++"
-	cppdialect "C++17"
+	cppdialect (edge.cppDialect)
 	location (path.join(repoRoot, "Build/Extensions/%{prj.name}"))
 	targetdir (path.join(repoRoot, "Bin/%{cfg.platform}/%{cfg.buildcfg}/Extensions"))
 
@@ -1,7 +1,7 @@
 project "Ext_ResourceIO"
 	kind "StaticLib"
 	language "C++"
-	cppdialect "C++17"
+	cppdialect (edge.cppDialect)
 	location (path.join(repoRoot, "Build/Extensions/%{prj.name}"))
 	targetdir (path.join(repoRoot, "Bin/%{cfg.platform}/%{cfg.buildcfg}/Extensions"))
 
@@ -26,7 +26,7 @@ void XMLMapObjectSerializer::serializeMaterials(xml::xml_node<>& node_) const
 
 		if (materials[i])
 		{
-			if (const_a textMat = dynamic_cast<IMapObject::Text*>(materials[i].get()))
+			if (const_a textMat = dynamic_cast<IMapObject::Text const*>(materials[i].get()))
 			{
 				XMLTextMaterialSerializer serializer{ *materials[i], static_cast<Uint8>( i ), node_ };
 
@@ -35,7 +35,7 @@ void XMLMapObjectSerializer::serializeMaterials(xml::xml_node<>& node_) const
 					std::clog << ModuleLogPrefix << "(Warning): Failed to serialize text material #" << i << "." << std::endl;
 				}
 			}
-			else if (const_a textureMat = dynamic_cast<IMapObject::Texture*>(materials[i].get()))
+			else if (const_a textureMat = dynamic_cast<IMapObject::Texture const*>(materials[i].get()))
 			{
 				XMLTextureMaterialSerializer serializer{ *materials[i], static_cast<Uint8>( i ), node_ };
 
@@ -5,6 +5,12 @@ include ("BuildConfig.user.lua")
 -- Custom library:
 include ("Premake/Library.lua")
 
+-- C++ standard used by every project:
+edge.cppDialect = "C++17"
+if userConfig.build.coroutines then
+	edge.cppDialect = "C++20"
+end
+
 workspace "SAMPEDGEngine"
 	location "Build"
 	platforms { "x86", "x64" }
@@ -46,6 +52,11 @@ workspace "SAMPEDGEngine"
 
 	filter {}
 
+	-- Coroutine support:
+	if userConfig.build.coroutines then
+		defines { "SAMP_EDGENGINE_COROUTINES" }
+	end
+
 	-- Projects:
 	include ("Engine/Premake5Build.lua")
 	include ("ServerCore/Premake5Build.lua")
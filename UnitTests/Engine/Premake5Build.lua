@@ -1,7 +1,7 @@
 project "UnitTest_Engine"
 	kind "ConsoleApp"
 	language "C++"
-	cppdialect "C++17"
+	cppdialect (edge.cppDialect)
 	filename "Engine"
 
 	location (path.join(repoRoot, "Build/%{prj.name}"))
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace samp = samp_cpp;
+
+TEST(BoundedMPSCQueue, RejectsWhenFull)
+{
+	samp::BoundedMPSCQueue<int> queue{ 4 };
+	EXPECT_EQ(queue.getCapacity(), 4u);
+
+	for (int i = 0; i < 4; ++i)
+		EXPECT_TRUE(queue.tryPush(i));
+	EXPECT_FALSE(queue.tryPush(4));
+
+	int value = -1;
+	for (int i = 0; i < 4; ++i)
+	{
+		EXPECT_TRUE(queue.tryPop(value));
+		EXPECT_EQ(value, i);
+	}
+	EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(BoundedMPSCQueue, MultipleProducers)
+{
+	constexpr int cxProducers			= 4;
+	constexpr int cxItemsPerProducer	= 10'000;
+
+	samp::BoundedMPSCQueue<int> queue{ 1024 };
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < cxProducers; ++p)
+	{
+		producers.emplace_back([&queue]
+			{
+				for (int i = 1; i <= cxItemsPerProducer; ++i)
+					while (!queue.tryPush(i))
+						std::this_thread::yield();
+			});
+	}
+
+	long long sum = 0;
+	int numPopped = 0;
+	int value;
+	while (numPopped < cxProducers * cxItemsPerProducer)
+	{
+		if (queue.tryPop(value))
+		{
+			sum += value;
+			++numPopped;
+		}
+	}
+
+	for (auto & producer : producers)
+		producer.join();
+
+	long long const expectedSum = static_cast<long long>(cxItemsPerProducer) * (cxItemsPerProducer + 1) / 2 * cxProducers;
+	EXPECT_EQ(sum, expectedSum);
+}
+
+TEST(MainThreadQueue, DrainRespectsBudget)
+{
+	samp::MainThreadQueue queue{ 8 };
+	queue.setDrainBudget(3);
+
+	int counter = 0;
+	for (int i = 0; i < 10; ++i)
+		queue.post([&counter]{ ++counter; });
+
+	EXPECT_EQ(queue.drain(), 3u);
+	EXPECT_EQ(counter, 3);
+
+	auto stats = queue.getStats();
+	EXPECT_EQ(stats.posted, 8u);
+	EXPECT_EQ(stats.rejected, 2u);
+	EXPECT_EQ(stats.executed, 3u);
+	EXPECT_EQ(stats.lastBacklog, 5u);
+	EXPECT_EQ(stats.peakBacklog, 8u);
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+namespace math = samp::math;
+
+TEST(CheckpointSet, FindsNearestCheckpoint)
+{
+	samp::PlayerCheckpointSet set;
+	for (int i = 0; i < 300; ++i)
+		set.add(samp::Checkpoint{ { i * 50.f, 0.f, 0.f }, 5.f });
+
+	EXPECT_EQ(set.findNearest({ 1010.f, 10.f, 0.f }, 400.f, 0, 0), 20u);
+	EXPECT_EQ(set.findNearest({ 0.f, 5000.f, 0.f }, 400.f, 0, 0), samp::PlayerCheckpointSet::NoCheckpoint);
+}
+
+TEST(CheckpointSet, RouteAdvancesInOrder)
+{
+	samp::PlayerRaceCheckpointSet route;
+	route.add(samp::RaceCheckpoint{ { 0.f, 0.f, 0.f }, {}, samp::RaceCheckpoint::Land, 8.f });
+	route.add(samp::RaceCheckpoint{ { 100.f, 0.f, 0.f }, {}, samp::RaceCheckpoint::Land, 8.f });
+	route.add(samp::RaceCheckpoint{ { 200.f, 0.f, 0.f }, {}, samp::RaceCheckpoint::Land, 8.f });
+	route.linkRoute();
+	route.setRouteMode(true);
+
+	EXPECT_EQ(route.get(0).getLookAt().x, 100.f);
+	EXPECT_EQ(route.get(2).getType(), samp::RaceCheckpoint::LandFinish);
+
+	// Route mode ignores the distance.
+	EXPECT_EQ(route.select({ 200.f, 0.f, 0.f }, 10.f, 0, 0), &route.get(0));
+	EXPECT_TRUE(route.advance());
+	EXPECT_TRUE(route.advance());
+	EXPECT_FALSE(route.advance());
+	EXPECT_TRUE(route.isFinished());
+	EXPECT_EQ(route.select({ 200.f, 0.f, 0.f }, 10.f, 0, 0), nullptr);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace samp = samp_cpp;
+
+namespace
+{
+
+using Dispatcher = samp::DeferredEventDispatcher<std::size_t, int>;
+
+/// <summary>
+/// Records every received event and optionally runs a reaction to it.
+/// </summary>
+struct Recorder
+	: samp::IEventReceiver
+{
+	std::vector< std::pair<std::size_t, int> >	received;
+	std::function<void(std::size_t, int)>		reaction;
+
+	void whenEvent(std::size_t key_, int value_)
+	{
+		received.emplace_back(key_, value_);
+		if (reaction)
+			reaction(key_, value_);
+	}
+};
+
+}
+
+TEST(DeferredEventDispatcher, CoalescesByKeyInOrderOfFirstPost)
+{
+	Dispatcher dispatcher;
+	Recorder recorder;
+	dispatcher += { recorder, &Recorder::whenEvent };
+
+	dispatcher.post(3, 3, 1);
+	dispatcher.post(1, 1, 1);
+	dispatcher.post(3, 3, 2);
+	EXPECT_EQ(dispatcher.getPendingCount(), 2u);
+
+	dispatcher.flush();
+
+	const std::vector< std::pair<std::size_t, int> > expected{ { 3, 2 }, { 1, 1 } };
+	EXPECT_EQ(recorder.received, expected);
+	EXPECT_EQ(dispatcher.getPendingCount(), 0u);
+
+	// Nothing left to deliver.
+	dispatcher.flush();
+	EXPECT_EQ(recorder.received.size(), 2u);
+}
+
+TEST(DeferredEventDispatcher, DiscardDropsPendingEvent)
+{
+	Dispatcher dispatcher;
+	Recorder recorder;
+	dispatcher += { recorder, &Recorder::whenEvent };
+
+	dispatcher.post(0, 0, 1);
+	dispatcher.post(1, 1, 1);
+	dispatcher.discard(0);
+	dispatcher.discard(7);	// Never posted.
+	EXPECT_EQ(dispatcher.getPendingCount(), 1u);
+
+	dispatcher.flush();
+
+	const std::vector< std::pair<std::size_t, int> > expected{ { 1, 1 } };
+	EXPECT_EQ(recorder.received, expected);
+}
+
+TEST(DeferredEventDispatcher, DiscardDuringFlushDropsUndeliveredEvent)
+{
+	Dispatcher dispatcher;
+	Recorder recorder;
+	dispatcher += { recorder, &Recorder::whenEvent };
+
+	recorder.reaction = [&](std::size_t key_, int) {
+			if (key_ == 0)
+				dispatcher.discard(1);
+		};
+
+	dispatcher.post(0, 0, 1);
+	dispatcher.post(1, 1, 1);
+	dispatcher.flush();
+
+	const std::vector< std::pair<std::size_t, int> > expected{ { 0, 1 } };
+	EXPECT_EQ(recorder.received, expected);
+}
+
+TEST(DeferredEventDispatcher, RepostDuringFlushIsDeliveredByNextFlush)
+{
+	Dispatcher dispatcher;
+	Recorder recorder;
+	dispatcher += { recorder, &Recorder::whenEvent };
+
+	recorder.reaction = [&](std::size_t key_, int value_) {
+			// Re-post both an already delivered key and a key that was not delivered yet.
+			if (value_ == 1)
+			{
+				dispatcher.post(0, 0, 2);
+				dispatcher.post(1, 1, 2);
+			}
+		};
+
+	dispatcher.post(0, 0, 1);
+	dispatcher.post(1, 1, 1);
+	dispatcher.flush();
+
+	// Second event still carries arguments posted before the flush.
+	const std::vector< std::pair<std::size_t, int> > firstFlush{ { 0, 1 }, { 1, 1 } };
+	EXPECT_EQ(recorder.received, firstFlush);
+	EXPECT_EQ(dispatcher.getPendingCount(), 2u);
+
+	recorder.received.clear();
+	dispatcher.flush();
+
+	const std::vector< std::pair<std::size_t, int> > secondFlush{ { 0, 2 }, { 1, 2 } };
+	EXPECT_EQ(recorder.received, secondFlush);
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+
+TEST(DenseSlotMap, RemoveKeepsOtherElementsReachable)
+{
+	samp::DenseSlotMap<int> map;
+	std::vector< samp::SharedPtr<int> > elements;
+	for (int i = 0; i < 5; ++i)
+	{
+		elements.push_back(std::make_shared<int>(i));
+		EXPECT_TRUE(map.insert(elements.back()));
+	}
+	EXPECT_FALSE(map.insert(elements[0]));
+
+	auto removed = map.remove(*elements[1]);
+	EXPECT_EQ(removed, elements[1]);
+	EXPECT_EQ(map.size(), 4u);
+	EXPECT_FALSE(map.contains(*elements[1]));
+
+	// Last element was moved into the freed position and still can be removed.
+	EXPECT_TRUE(map.remove(*elements[4]));
+	EXPECT_FALSE(map.remove(*elements[4]));
+	EXPECT_EQ(map.size(), 3u);
+
+	int sum = 0;
+	for (auto const & element : map)
+		sum += *element;
+	EXPECT_EQ(sum, 0 + 2 + 3);
+}
+
+TEST(DenseSlotMap, StoresNonOwningPointers)
+{
+	int values[3] = { 1, 2, 3 };
+
+	samp::DenseSlotMap<int, int*> map;
+	for (auto & value : values)
+		EXPECT_TRUE(map.insert(&value));
+	EXPECT_TRUE(map.contains(values[1]));
+
+	EXPECT_EQ(map.remove(values[0]), &values[0]);
+	EXPECT_EQ(map.remove(values[0]), nullptr);
+	EXPECT_TRUE(map.contains(values[2]));
+	EXPECT_EQ(map.remove(values[2]), &values[2]);
+	EXPECT_EQ(map.size(), 1u);
+	EXPECT_EQ(map[0], &values[1]);
+}
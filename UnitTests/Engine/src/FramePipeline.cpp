@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace samp = samp_cpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+/// <summary>
+/// Records phases in order of execution and overruns reported by the pipeline.
+/// </summary>
+struct PhaseRecorder
+	: samp::IEventReceiver
+{
+	samp::FramePipeline&					pipeline;
+	std::vector<samp::FramePhase>			phases;
+	std::vector<samp::FramePhase>			overruns;
+	samp::FramePipeline::Duration			remainingBudget = samp::FramePipeline::Duration::zero();
+
+	explicit PhaseRecorder(samp::FramePipeline & pipeline_)
+		: pipeline{ pipeline_ }
+	{
+	}
+
+	void whenPhaseRuns(double, samp::IUpdatable::TimePoint)
+	{
+		phases.push_back(*pipeline.getCurrentPhase());
+		remainingBudget = pipeline.getRemainingBudget();
+	}
+
+	void whenPhaseOverruns(samp::FramePhase phase_, samp::FramePipeline::Duration, samp::FramePipeline::Duration)
+	{
+		overruns.push_back(phase_);
+	}
+};
+
+/// <summary>
+/// Runs every phase in order, the same way the server does.
+/// </summary>
+void runFrame(samp::FramePipeline & pipeline_)
+{
+	pipeline_.beginFrame();
+	for (std::size_t i = 0; i < samp::FramePipeline::PhaseCount; ++i)
+		pipeline_.runPhase(static_cast<samp::FramePhase>(i), 0.0, samp::IUpdatable::Clock::now());
+}
+
+}
+
+TEST(FramePipeline, RunsEngineRoutineBeforeHandlers)
+{
+	samp::FramePipeline pipeline;
+	PhaseRecorder recorder{ pipeline };
+	pipeline[samp::FramePhase::Input]		+= { recorder, &PhaseRecorder::whenPhaseRuns };
+	pipeline[samp::FramePhase::Output]		+= { recorder, &PhaseRecorder::whenPhaseRuns };
+	pipeline[samp::FramePhase::Streaming]	+= { recorder, &PhaseRecorder::whenPhaseRuns };
+
+	std::vector<samp::FramePhase> routines;
+	pipeline.beginFrame();
+	for (std::size_t i = 0; i < samp::FramePipeline::PhaseCount; ++i)
+	{
+		const auto phase = static_cast<samp::FramePhase>(i);
+		pipeline.runPhase(phase, 0.0, samp::IUpdatable::Clock::now(),
+				[&] {
+					EXPECT_EQ(pipeline.getCurrentPhase(), phase);
+					// Handlers of this phase did not run yet.
+					EXPECT_TRUE(recorder.phases.empty() || recorder.phases.back() != phase);
+					routines.push_back(phase);
+				}
+			);
+	}
+
+	EXPECT_EQ(pipeline.getFrameNumber(), 1u);
+	EXPECT_FALSE(pipeline.getCurrentPhase());
+	EXPECT_EQ(routines.size(), samp::FramePipeline::PhaseCount);
+
+	const std::vector<samp::FramePhase> expected{ samp::FramePhase::Input, samp::FramePhase::Streaming, samp::FramePhase::Output };
+	EXPECT_EQ(recorder.phases, expected);
+}
+
+TEST(FramePipeline, DetectsBudgetOverrun)
+{
+	samp::FramePipeline pipeline;
+	PhaseRecorder recorder{ pipeline };
+	pipeline.onPhaseOverrun += { recorder, &PhaseRecorder::whenPhaseOverruns };
+
+	pipeline.setBudget(samp::FramePhase::Simulation, 1us);
+	pipeline.setBudget(samp::FramePhase::Streaming, 1h);
+
+	pipeline.beginFrame();
+	pipeline.runPhase(samp::FramePhase::Simulation, 0.0, samp::IUpdatable::Clock::now(),
+			[] { std::this_thread::sleep_for(2ms); }
+		);
+	pipeline.runPhase(samp::FramePhase::Streaming, 0.0, samp::IUpdatable::Clock::now());
+
+	const auto& stats = pipeline.getStats(samp::FramePhase::Simulation);
+	EXPECT_GE(stats.lastDuration, 2ms);
+	EXPECT_GE(stats.maxDuration, stats.lastDuration);
+	EXPECT_EQ(stats.overrunCount, 1u);
+	EXPECT_EQ(pipeline.getStats(samp::FramePhase::Streaming).overrunCount, 0u);
+
+	const std::vector<samp::FramePhase> expected{ samp::FramePhase::Simulation };
+	EXPECT_EQ(recorder.overruns, expected);
+
+	pipeline.resetStats();
+	EXPECT_EQ(pipeline.getStats(samp::FramePhase::Simulation).overrunCount, 0u);
+	EXPECT_EQ(pipeline.getStats(samp::FramePhase::Simulation).maxDuration, samp::FramePipeline::Duration::zero());
+}
+
+TEST(FramePipeline, ReportsRemainingBudget)
+{
+	samp::FramePipeline pipeline;
+	PhaseRecorder recorder{ pipeline };
+	pipeline[samp::FramePhase::Streaming]	+= { recorder, &PhaseRecorder::whenPhaseRuns };
+	pipeline[samp::FramePhase::Output]		+= { recorder, &PhaseRecorder::whenPhaseRuns };
+
+	EXPECT_EQ(pipeline.getRemainingBudget(), samp::FramePipeline::Duration::max());
+
+	pipeline.setBudget(samp::FramePhase::Streaming, 1h);
+	pipeline.beginFrame();
+
+	pipeline.runPhase(samp::FramePhase::Streaming, 0.0, samp::IUpdatable::Clock::now());
+	EXPECT_GT(recorder.remainingBudget, samp::FramePipeline::Duration::zero());
+	EXPECT_LE(recorder.remainingBudget, samp::FramePipeline::Duration{ 1h });
+
+	// No budget.
+	pipeline.runPhase(samp::FramePhase::Output, 0.0, samp::IUpdatable::Clock::now());
+	EXPECT_EQ(recorder.remainingBudget, samp::FramePipeline::Duration::max());
+}
+
+TEST(FramePipeline, ThrowingPhaseDoesNotBreakNextFrame)
+{
+	samp::FramePipeline pipeline;
+	PhaseRecorder recorder{ pipeline };
+	pipeline[samp::FramePhase::Input] += { recorder, &PhaseRecorder::whenPhaseRuns };
+
+	pipeline.beginFrame();
+	EXPECT_THROW(
+			pipeline.runPhase(samp::FramePhase::Simulation, 0.0, samp::IUpdatable::Clock::now(),
+					[] { throw std::runtime_error{ "routine failed" }; }
+				),
+			std::runtime_error
+		);
+	EXPECT_FALSE(pipeline.getCurrentPhase());
+	EXPECT_EQ(pipeline.getStats(samp::FramePhase::Simulation).lastDuration, samp::FramePipeline::Duration::zero());
+
+	runFrame(pipeline);
+	EXPECT_EQ(pipeline.getFrameNumber(), 2u);
+	EXPECT_EQ(recorder.phases.size(), 1u);
+}
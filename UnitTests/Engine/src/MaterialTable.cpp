@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+
+TEST(MaterialTable, InternsEqualMaterialsOnce)
+{
+	samp::MaterialTable table;
+
+	samp::IMapObject::Texture brick;
+	brick.modelIndex	= 1337;
+	brick.txdName		= "ws_garage";
+	brick.textureName	= "brick";
+
+	samp::IMapObject::Texture sameBrick = brick;
+	samp::IMapObject::Texture otherBrick = brick;
+	otherBrick.textureName = "brick2";
+
+	const auto first = table.intern(brick);
+	EXPECT_EQ(table.intern(sameBrick), first);
+	EXPECT_NE(table.intern(otherBrick), first);
+
+	samp::IMapObject::Text label;
+	label.text = "Hello";
+	EXPECT_EQ(table.intern(label), table.intern(label));
+	EXPECT_EQ(table.size(), 3u);
+}
+
+TEST(MaterialTable, PurgesOnlyUnusedMaterials)
+{
+	samp::MaterialTable table;
+
+	samp::IMapObject::Text used, unused;
+	used.text	= "used";
+	unused.text	= "unused";
+
+	const auto handle = table.intern(used);
+	table.intern(unused);
+
+	EXPECT_EQ(table.purgeUnused(), 1u);
+	EXPECT_EQ(table.size(), 1u);
+	EXPECT_EQ(table.intern(used), handle);
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+namespace math = samp::math;
+
+TEST(ObjectMotion, InterpolatesLocationAndRotation)
+{
+	using namespace std::chrono_literals;
+
+	const auto start = samp::IUpdatable::TimePoint{} + 10s;
+	const auto motion = samp::ObjectMotion::begin(
+			math::Vector3f{ 0, 0, 0 }, math::Vector3f{ 0, 0, 90 },
+			math::Vector3f{ 20, 0, 0 }, math::Vector3f{ 0, 0, 180 },
+			10.f, start
+		);
+
+	EXPECT_EQ(motion.duration, std::chrono::duration_cast<samp::IUpdatable::Duration>(2s));
+
+	const auto half = motion.locationAt(start + 1s);
+	EXPECT_NEAR(half.x, 10.f, 0.001f);
+	EXPECT_NEAR(motion.rotationAt(start + 1s).z, 135.f, 0.001f);
+	EXPECT_FALSE(motion.isFinishedAt(start + 1s));
+
+	// Clamped on both ends.
+	EXPECT_NEAR(motion.locationAt(start - 1s).x, 0.f, 0.001f);
+	EXPECT_NEAR(motion.locationAt(start + 5s).x, 20.f, 0.001f);
+	EXPECT_TRUE(motion.isFinishedAt(start + 2s));
+}
+
+TEST(ObjectMotion, KeepsRotationWithoutTarget)
+{
+	const auto start = samp::IUpdatable::TimePoint{};
+	const auto motion = samp::ObjectMotion::begin(
+			math::Vector3f{ 0, 0, 0 }, math::Vector3f{ 1, 2, 3 },
+			math::Vector3f{ 0, 5, 0 }, std::nullopt,
+			1.f, start
+		);
+
+	const auto rotation = motion.rotationAt(start + std::chrono::seconds{ 3 });
+	EXPECT_EQ(rotation.x, 1.f);
+	EXPECT_EQ(rotation.y, 2.f);
+	EXPECT_EQ(rotation.z, 3.f);
+}
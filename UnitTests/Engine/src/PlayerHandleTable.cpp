@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+
+TEST(PlayerHandleTable, InsertFindRemove)
+{
+	samp::PlayerHandleTable<samp::Int32, 200> table;
+	EXPECT_TRUE(table.insert(130, 7));
+	EXPECT_TRUE(table.insert(3, 1));
+	EXPECT_TRUE(table.insert(64, 5));
+	EXPECT_FALSE(table.insert(64, 6));
+	EXPECT_FALSE(table.insert(200, 9));
+	EXPECT_EQ(table.size(), 3u);
+
+	EXPECT_EQ(table.find(3), 1);
+	EXPECT_EQ(table.find(64), 5);
+	EXPECT_EQ(table.find(130), 7);
+	EXPECT_FALSE(table.find(4).has_value());
+
+	EXPECT_EQ(table.remove(64), 5);
+	EXPECT_FALSE(table.remove(64).has_value());
+	EXPECT_FALSE(table.contains(64));
+	EXPECT_EQ(table.find(130), 7);
+}
+
+TEST(PlayerHandleTable, ForEachVisitsSlotsInOrder)
+{
+	samp::PlayerHandleTable<samp::Int32, 200> table;
+	for (std::size_t slot : { 199u, 0u, 63u, 64u, 100u })
+		table.insert(slot, static_cast<samp::Int32>(slot) * 10);
+
+	std::vector<std::size_t> slots;
+	table.forEach(
+		[&](std::size_t slot_, samp::Int32 handle_)
+		{
+			EXPECT_EQ(handle_, static_cast<samp::Int32>(slot_) * 10);
+			slots.push_back(slot_);
+		});
+	EXPECT_EQ(slots, (std::vector<std::size_t>{ 0, 63, 64, 100, 199 }));
+}
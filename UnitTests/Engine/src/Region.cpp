@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+namespace math = samp::math;
+
+TEST(Region, BoxContainsPointsInsideBounds)
+{
+	const auto box = samp::Region::box({ 10.f, 10.f, 0.f }, { -10.f, -10.f, 5.f });
+
+	EXPECT_TRUE(box.contains(math::Vector3f{ 0.f, 0.f, 1.f }));
+	EXPECT_TRUE(box.contains(math::Vector3f{ -10.f, 10.f, 5.f }));
+	EXPECT_FALSE(box.contains(math::Vector3f{ 0.f, 0.f, 6.f }));
+	EXPECT_FALSE(box.contains(math::Vector3f{ 11.f, 0.f, 1.f }));
+}
+
+TEST(Region, SphereChecksDistance)
+{
+	const auto sphere = samp::Region::sphere({ 100.f, 0.f, 0.f }, 10.f);
+
+	EXPECT_TRUE(sphere.contains(math::Vector3f{ 105.f, 5.f, 5.f }));
+	// Inside bounding box, outside the sphere.
+	EXPECT_FALSE(sphere.contains(math::Vector3f{ 109.f, 9.f, 0.f }));
+}
+
+TEST(Region, PolygonUsesEvenOddRule)
+{
+	// L-shaped polygon.
+	const auto polygon = samp::Region::polygon(
+			{ { 0.f, 0.f }, { 20.f, 0.f }, { 20.f, 10.f }, { 10.f, 10.f }, { 10.f, 20.f }, { 0.f, 20.f } },
+			-5.f, 5.f
+		);
+
+	EXPECT_TRUE(polygon.contains(math::Vector3f{ 5.f, 15.f, 0.f }));
+	EXPECT_TRUE(polygon.contains(math::Vector3f{ 15.f, 5.f, 0.f }));
+	EXPECT_FALSE(polygon.contains(math::Vector3f{ 15.f, 15.f, 0.f }));
+	EXPECT_FALSE(polygon.contains(math::Vector3f{ 5.f, 5.f, 10.f }));
+}
+
+TEST(Region, ScopedToWorldAndInterior)
+{
+	const auto box = samp::Region::box({ -1.f, -1.f, -1.f }, { 1.f, 1.f, 1.f }, 3, samp::Region::Any);
+
+	EXPECT_TRUE(box.contains(samp::ActorPlacement{ { 0.f, 0.f, 0.f }, 3, 7 }));
+	EXPECT_FALSE(box.contains(samp::ActorPlacement{ { 0.f, 0.f, 0.f }, 0, 7 }));
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+namespace samp = samp_cpp;
+namespace math = samp::math;
+
+namespace
+{
+
+samp::RemovedBuilding makeRemoval(samp::Int32 model_, math::Vector3f const & origin_, float radius_)
+{
+	samp::RemovedBuilding building;
+	building.model	= model_;
+	building.origin	= origin_;
+	building.radius	= math::Meters{ radius_ };
+	return building;
+}
+
+}
+
+TEST(RemovedBuildingSet, IgnoresDuplicatesAndCoveredRemovals)
+{
+	samp::RemovedBuildingSet set;
+
+	EXPECT_TRUE(set.add(makeRemoval(1000, { 0.f, 0.f, 0.f }, 50.f)));
+	EXPECT_FALSE(set.add(makeRemoval(1000, { 0.f, 0.f, 0.f }, 50.f)));
+	EXPECT_FALSE(set.add(makeRemoval(1000, { 10.f, 0.f, 0.f }, 20.f)));
+
+	// Different model or sphere sticking out is not covered.
+	EXPECT_TRUE(set.add(makeRemoval(1001, { 10.f, 0.f, 0.f }, 20.f)));
+	EXPECT_TRUE(set.add(makeRemoval(1000, { 40.f, 0.f, 0.f }, 20.f)));
+	EXPECT_EQ(set.size(), 3u);
+}
+
+TEST(RemovedBuildingSet, LargerRemovalReplacesCoveredOnes)
+{
+	samp::RemovedBuildingSet set;
+	set.add(makeRemoval(1000, { 0.f, 0.f, 0.f }, 5.f));
+	set.add(makeRemoval(1001, { 10.f, 0.f, 0.f }, 5.f));
+	set.add(makeRemoval(1002, { 500.f, 0.f, 0.f }, 5.f));
+
+	EXPECT_TRUE(set.add(makeRemoval(samp::RemovedBuilding::AnyModel, { 0.f, 0.f, 0.f }, 100.f)));
+	EXPECT_EQ(set.size(), 2u);
+
+	// Replaced removals are no longer stored, so queued copies can be skipped.
+	EXPECT_FALSE(set.contains(makeRemoval(1000, { 0.f, 0.f, 0.f }, 5.f)));
+	EXPECT_FALSE(set.contains(makeRemoval(1001, { 10.f, 0.f, 0.f }, 5.f)));
+	EXPECT_TRUE(set.contains(makeRemoval(1002, { 500.f, 0.f, 0.f }, 5.f)));
+}
+
+TEST(RemovedBuildingSet, CoalesceKeepsOnlyUncoveredRemovals)
+{
+	std::vector<samp::RemovedBuilding> buildings;
+	for (int i = 0; i < 100; ++i)
+		buildings.push_back(makeRemoval(1000, { static_cast<float>(i % 10), 0.f, 0.f }, 1.f));
+	buildings.push_back(makeRemoval(1000, { 5.f, 0.f, 0.f }, 20.f));
+	// Overlaps, but is not inside - must stay.
+	buildings.push_back(makeRemoval(1000, { 30.f, 0.f, 0.f }, 15.f));
+	buildings.push_back(makeRemoval(1001, { 0.f, 0.f, 0.f }, 1.f));
+
+	const auto result = samp::RemovedBuildingSet::coalesce(buildings);
+	EXPECT_EQ(result.size(), 3u);
+}
+
+TEST(RemovedBuildingSet, CoalesceWithWholeMapRemoval)
+{
+	std::vector<samp::RemovedBuilding> buildings;
+	buildings.push_back(makeRemoval(samp::RemovedBuilding::AnyModel, { 0.f, 0.f, 0.f }, 6000.f));
+	for (int i = 0; i < 1500; ++i)
+		buildings.push_back(makeRemoval(1000 + i % 50, { static_cast<float>(i % 100) * 30.f, static_cast<float>(i / 100) * 30.f, 0.f }, 5.f));
+	// Outside of the whole-map removal - must stay.
+	buildings.push_back(makeRemoval(1000, { 7000.f, 0.f, 0.f }, 5.f));
+	// Large, but not of any model - covers nearby removals of the same model only.
+	buildings.push_back(makeRemoval(2000, { 7000.f, 0.f, 0.f }, 500.f));
+	buildings.push_back(makeRemoval(2000, { 7100.f, 0.f, 0.f }, 5.f));
+
+	const auto result = samp::RemovedBuildingSet::coalesce(buildings);
+	ASSERT_EQ(result.size(), 3u);
+	EXPECT_EQ(result[0].model, samp::RemovedBuilding::AnyModel);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace samp = samp_cpp;
+namespace math = samp::math;
+
+TEST(SpatialHashGrid, RadiusQueryMatchesBruteForce)
+{
+	samp::SpatialHashGrid<int> grid{ 50.f };
+
+	std::mt19937 gen{ 7 };
+	std::uniform_real_distribution<float> coord{ -500.f, 500.f };
+
+	std::vector<math::Vector3f> points;
+	for (int i = 0; i < 500; ++i)
+	{
+		points.push_back( math::Vector3f{ coord(gen), coord(gen), coord(gen) / 10.f } );
+		grid.insert(points.back(), i);
+	}
+
+	const math::Vector3f center{ 12.f, -40.f, 0.f };
+	const float radius = 120.f;
+
+	std::vector<int> found;
+	grid.forEachInRadius(center, radius, [&found](auto const & entry_) { found.push_back(entry_.value); });
+
+	std::vector<int> expected;
+	for (int i = 0; i < static_cast<int>(points.size()); ++i)
+		if (points[i].distanceSquared(center) <= radius * radius)
+			expected.push_back(i);
+
+	std::sort(found.begin(), found.end());
+	EXPECT_EQ(found, expected);
+}
+
+TEST(SpatialHashGrid, FindNearestIsSortedAndExact)
+{
+	samp::SpatialHashGrid<int> grid{ 10.f };
+	grid.insert({ 100.f, 0.f, 0.f }, 3);
+	grid.insert({ 5.f, 0.f, 0.f }, 1);
+	grid.insert({ 0.f, 25.f, 0.f }, 2);
+	grid.insert({ -1000.f, 0.f, 0.f }, 4);
+
+	auto nearest = grid.findNearest({ 0.f, 0.f, 0.f }, 3, 500.f);
+	ASSERT_EQ(nearest.size(), 3u);
+	EXPECT_EQ(nearest[0]->value, 1);
+	EXPECT_EQ(nearest[1]->value, 2);
+	EXPECT_EQ(nearest[2]->value, 3);
+
+	auto filtered = grid.findNearest({ 0.f, 0.f, 0.f }, 1, 500.f, [](auto const & entry_) { return entry_.value != 1; });
+	ASSERT_EQ(filtered.size(), 1u);
+	EXPECT_EQ(filtered[0]->value, 2);
+}
+
+TEST(SpatialHashGrid, RemoveAndMove)
+{
+	samp::SpatialHashGrid<int> grid{ 10.f };
+	grid.insert({ 0.f, 0.f, 0.f }, 1);
+	grid.move({ 0.f, 0.f, 0.f }, { 55.f, 55.f, 0.f }, 1);
+
+	EXPECT_TRUE(grid.findNearest({ 0.f, 0.f, 0.f }, 1, 20.f).empty());
+	EXPECT_EQ(grid.findNearest({ 50.f, 50.f, 0.f }, 1, 20.f).size(), 1u);
+
+	EXPECT_TRUE(grid.remove({ 55.f, 55.f, 0.f }, 1));
+	EXPECT_FALSE(grid.remove({ 55.f, 55.f, 0.f }, 1));
+	EXPECT_EQ(grid.size(), 0u);
+}
+
+TEST(SpatialHashGrid, HugeRadiusMatchesBruteForce)
+{
+	samp::SpatialHashGrid<int> grid{ 50.f };
+
+	std::mt19937 gen{ 11 };
+	std::uniform_real_distribution<float> coord{ -3000.f, 3000.f };
+
+	std::vector<math::Vector3f> points;
+	for (int i = 0; i < 200; ++i)
+	{
+		points.push_back( math::Vector3f{ coord(gen), coord(gen), 0.f } );
+		grid.insert(points.back(), i);
+	}
+
+	const math::Vector3f center{ 1.f, 2.f, 0.f };
+	for (float radius : { 5000.f, std::numeric_limits<float>::max() })
+	{
+		std::vector<int> found;
+		grid.forEachInRadius(center, radius, [&found](auto const & entry_) { found.push_back(entry_.value); });
+		EXPECT_EQ(found.size(), points.size());
+
+		auto nearest = grid.findNearest(center, 3, radius);
+		ASSERT_EQ(nearest.size(), 3u);
+
+		std::vector<float> distances;
+		for (auto const & point : points)
+			distances.push_back(point.distanceSquared(center));
+		std::sort(distances.begin(), distances.end());
+		for (std::size_t i = 0; i < nearest.size(); ++i)
+			EXPECT_EQ(nearest[i]->location.distanceSquared(center), distances[i]);
+	}
+}
+
+TEST(SpatialHashGrid, CellsOfNonFiniteCoordinatesAreClamped)
+{
+	using Cells = samp::GridCells;
+
+	const auto inf = std::numeric_limits<float>::infinity();
+	const auto nan = std::numeric_limits<float>::quiet_NaN();
+
+	const auto minCell = Cells::cellOf(-inf, nan, 100.f);
+	const auto maxCell = Cells::cellOf(inf, inf, 100.f);
+	EXPECT_EQ(minCell, Cells::cellOf(-Cells::MaxCoord, -Cells::MaxCoord, 100.f));
+	EXPECT_EQ(maxCell, Cells::cellOf(Cells::MaxCoord, Cells::MaxCoord, 100.f));
+
+	// Whole clamped plane is a finite (but huge) number of cells.
+	EXPECT_GT(Cells::countCells(minCell, maxCell), 1e8);
+	EXPECT_EQ(Cells::countCells(maxCell, minCell), 0.0);
+
+	EXPECT_EQ(Cells::unpackKey( Cells::packKey(-3, 7) ), Cells::Coords(-3, 7));
+}
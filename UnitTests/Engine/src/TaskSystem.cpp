@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <SAMPCpp/Everything.hpp>
+
+#include <chrono>
+#include <stdexcept>
+
+namespace samp = samp_cpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+/// <summary>
+/// Runs scheduler update far enough in the future for every task to be ready.
+/// </summary>
+void updateLater(samp::TaskScheduler & scheduler_)
+{
+	scheduler_.update(0, samp::IUpdatable::Clock::now() + 1h);
+}
+
+}
+
+TEST(TaskSystem, ExecutesAndReleasesTask)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	auto handle = scheduler.schedule(0ms, [&]{ ++counter; }, 2);
+	EXPECT_TRUE(scheduler.isScheduled(handle));
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 1);
+	EXPECT_TRUE(scheduler.isScheduled(handle));
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 2);
+	EXPECT_FALSE(scheduler.isScheduled(handle));
+	EXPECT_EQ(scheduler.get(handle), nullptr);
+}
+
+TEST(TaskSystem, CancelledTaskDoesNotRun)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	auto handle = scheduler.schedule(0ms, [&]{ ++counter; });
+	EXPECT_TRUE(scheduler.cancel(handle));
+	EXPECT_FALSE(scheduler.cancel(handle));
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 0);
+}
+
+TEST(TaskSystem, StaleHandleDoesNotCancelReusedSlot)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	auto first = scheduler.schedule(0ms, [&]{ ++counter; });
+	scheduler.cancel(first);
+
+	auto second = scheduler.schedule(0ms, [&]{ ++counter; });
+	EXPECT_EQ(first.index, second.index);
+	EXPECT_FALSE(scheduler.cancel(first));
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 1);
+}
+
+TEST(TaskSystem, TaskCanCancelItself)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	samp::TaskHandle handle;
+	handle = scheduler.schedule(0ms, [&]{ ++counter; scheduler.cancel(handle); }, 10);
+
+	updateLater(scheduler);
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 1);
+	EXPECT_FALSE(scheduler.isScheduled(handle));
+}
+
+TEST(TaskSystem, OwnerCancelsTasksOnDestruction)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	{
+		samp::ITaskOwner owner;
+		owner.interceptTask(scheduler, scheduler.schedule(0ms, [&]{ ++counter; }));
+	}
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 0);
+}
+
+#ifdef SAMP_EDGENGINE_COROUTINES
+
+namespace
+{
+
+samp::Coroutine countSteps(int & counter_)
+{
+	++counter_;
+	co_await samp::nextTick();
+	++counter_;
+	co_await samp::sleepFor(10ms);
+	++counter_;
+}
+
+samp::Coroutine sleepThenCount(int & counter_)
+{
+	co_await samp::sleepFor(10ms);
+	++counter_;
+}
+
+samp::Coroutine throwAfterTick()
+{
+	co_await samp::nextTick();
+	throw std::runtime_error{ "failure" };
+}
+
+struct ExceptionCounter
+	: samp::IEventReceiver
+{
+	int count = 0;
+
+	void whenThrown(std::exception_ptr) {
+		++count;
+	}
+};
+
+}
+
+TEST(TaskSystem, CoroutineIsResumedByScheduler)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	scheduler.start(countSteps(counter));
+	EXPECT_EQ(counter, 1);
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 2);
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 3);
+}
+
+TEST(TaskSystem, CancelledCoroutineIsNotResumed)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	auto handle = scheduler.start(sleepThenCount(counter));
+	EXPECT_TRUE(scheduler.isScheduled(handle));
+	EXPECT_TRUE(scheduler.cancel(handle));
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 0);
+	EXPECT_FALSE(scheduler.isScheduled(handle));
+}
+
+TEST(TaskSystem, OwnerCancelsCoroutineOnDestruction)
+{
+	samp::TaskScheduler scheduler;
+	int counter = 0;
+
+	{
+		samp::ITaskOwner owner;
+		scheduler.start(owner, sleepThenCount(counter));
+	}
+
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 0);
+}
+
+TEST(TaskSystem, CoroutineExceptionDoesNotEscapeUpdate)
+{
+	samp::TaskScheduler scheduler;
+	ExceptionCounter exceptions;
+	scheduler.onCoroutineException += { exceptions, &ExceptionCounter::whenThrown };
+
+	int counter = 0;
+	auto failing = scheduler.start(throwAfterTick());
+	scheduler.start(countSteps(counter));
+
+	EXPECT_NO_THROW(updateLater(scheduler));
+	EXPECT_EQ(exceptions.count, 1);
+	EXPECT_FALSE(scheduler.isScheduled(failing));
+
+	// Other coroutines keep running.
+	EXPECT_EQ(counter, 2);
+	updateLater(scheduler);
+	EXPECT_EQ(counter, 3);
+}
+
+#endif